@@ -749,7 +749,9 @@ cleanup:
 
 static void test_query_value_ex(void)
 {
-    DWORD ret, size, type;
+    static const DWORD big_sizes[] = { 200, 1000, 4096, 6000 };
+    static BYTE big_data[6000], big_buffer[8000], big_expect[8000];
+    DWORD ret, size, type, i;
     BYTE buffer[10];
 
     size = sizeof(buffer);
@@ -772,6 +774,32 @@ static void test_query_value_ex(void)
     size = 4;
     ret = RegQueryValueExA(hkey_main, "BIN32", NULL, &size, buffer, &size);
     ok(ret == ERROR_SUCCESS, "expected ERROR_SUCCESS, got %ld\n", ret);
+
+    /* values larger than a small stack buffer */
+    for (i = 0; i < sizeof(big_data); i++) big_data[i] = i * 7 + 1;
+    memset(big_expect, 0xcc, sizeof(big_expect));
+    for (i = 0; i < ARRAY_SIZE(big_sizes); i++)
+    {
+        ret = RegSetValueExW(hkey_main, L"big", 0, REG_BINARY, big_data, big_sizes[i]);
+        ok(ret == ERROR_SUCCESS, "expected ERROR_SUCCESS, got %ld\n", ret);
+
+        memset(big_buffer, 0xcc, sizeof(big_buffer));
+        type = 0xdeadbeef;
+        size = sizeof(big_buffer);
+        ret = RegQueryValueExW(hkey_main, L"big", NULL, &type, big_buffer, &size);
+        ok(ret == ERROR_SUCCESS, "%ld: expected ERROR_SUCCESS, got %ld\n", big_sizes[i], ret);
+        ok(type == REG_BINARY, "%ld: got type %ld\n", big_sizes[i], type);
+        ok(size == big_sizes[i], "%ld: got size %ld\n", big_sizes[i], size);
+        ok(!memcmp(big_buffer, big_data, big_sizes[i]), "%ld: wrong data\n", big_sizes[i]);
+
+        memset(big_buffer, 0xcc, sizeof(big_buffer));
+        size = big_sizes[i] - 1;
+        ret = RegQueryValueExW(hkey_main, L"big", NULL, &type, big_buffer, &size);
+        ok(ret == ERROR_MORE_DATA, "%ld: expected ERROR_MORE_DATA, got %ld\n", big_sizes[i], ret);
+        ok(size == big_sizes[i], "%ld: got size %ld\n", big_sizes[i], size);
+        ok(!memcmp(big_buffer, big_expect, sizeof(big_buffer)), "%ld: buffer should not be modified\n", big_sizes[i]);
+    }
+    RegDeleteValueW(hkey_main, L"big");
 }
 
 static void test_get_value(void)
@@ -1825,18 +1825,17 @@ D3DXVECTOR3* WINAPI D3DXVec3Normalize(D3DXVECTOR3 *pout, const D3DXVECTOR3 *pv)
     return pout;
 }
 
-D3DXVECTOR3* WINAPI D3DXVec3Project(D3DXVECTOR3 *pout, const D3DXVECTOR3 *pv, const D3DVIEWPORT9 *pviewport, const D3DXMATRIX *pprojection, const D3DXMATRIX *pview, const D3DXMATRIX *pworld)
+static void get_projection_matrix(D3DXMATRIX *m, const D3DXMATRIX *projection, const D3DXMATRIX *view, const D3DXMATRIX *world)
 {
-    D3DXMATRIX m;
-
-    TRACE("pout %p, pv %p, pviewport %p, pprojection %p, pview %p, pworld %p\n", pout, pv, pviewport, pprojection, pview, pworld);
-
-    D3DXMatrixIdentity(&m);
-    if (pworld) D3DXMatrixMultiply(&m, &m, pworld);
-    if (pview) D3DXMatrixMultiply(&m, &m, pview);
-    if (pprojection) D3DXMatrixMultiply(&m, &m, pprojection);
+    D3DXMatrixIdentity(m);
+    if (world) D3DXMatrixMultiply(m, m, world);
+    if (view) D3DXMatrixMultiply(m, m, view);
+    if (projection) D3DXMatrixMultiply(m, m, projection);
+}
 
-    D3DXVec3TransformCoord(pout, pv, &m);
+static void project_vector(D3DXVECTOR3 *pout, const D3DXVECTOR3 *pv, const D3DVIEWPORT9 *pviewport, const D3DXMATRIX *m)
+{
+    D3DXVec3TransformCoord(pout, pv, m);
 
     if (pviewport)
     {
@@ -1844,21 +1843,35 @@ D3DXVECTOR3* WINAPI D3DXVec3Project(D3DXVECTOR3 *pout, const D3DXVECTOR3 *pv, co
         pout->y = pviewport->Y +  ( 1.0f - pout->y ) * pviewport->Height / 2.0f;
         pout->z = pviewport->MinZ + pout->z * ( pviewport->MaxZ - pviewport->MinZ );
     }
+}
+
+D3DXVECTOR3* WINAPI D3DXVec3Project(D3DXVECTOR3 *pout, const D3DXVECTOR3 *pv, const D3DVIEWPORT9 *pviewport, const D3DXMATRIX *pprojection, const D3DXMATRIX *pview, const D3DXMATRIX *pworld)
+{
+    D3DXMATRIX m;
+
+    TRACE("pout %p, pv %p, pviewport %p, pprojection %p, pview %p, pworld %p\n", pout, pv, pviewport, pprojection, pview, pworld);
+
+    get_projection_matrix(&m, pprojection, pview, pworld);
+    project_vector(pout, pv, pviewport, &m);
     return pout;
 }
 
 D3DXVECTOR3* WINAPI D3DXVec3ProjectArray(D3DXVECTOR3* out, UINT outstride, const D3DXVECTOR3* in, UINT instride, const D3DVIEWPORT9* viewport, const D3DXMATRIX* projection, const D3DXMATRIX* view, const D3DXMATRIX* world, UINT elements)
 {
+    D3DXMATRIX m;
     UINT i;
 
     TRACE("out %p, outstride %u, in %p, instride %u, viewport %p, projection %p, view %p, world %p, elements %u\n",
         out, outstride, in, instride, viewport, projection, view, world, elements);
 
+    /* the matrix is the same for all the elements */
+    get_projection_matrix(&m, projection, view, world);
+
     for (i = 0; i < elements; ++i) {
-        D3DXVec3Project(
+        project_vector(
             (D3DXVECTOR3*)((char*)out + outstride * i),
             (const D3DXVECTOR3*)((const char*)in + instride * i),
-            viewport, projection, view, world);
+            viewport, &m);
     }
     return out;
 }
@@ -1953,6 +1966,18 @@ D3DXVECTOR3* WINAPI D3DXVec3TransformNormalArray(D3DXVECTOR3* out, UINT outstrid
     return out;
 }
 
+static void unproject_vector(D3DXVECTOR3 *out, const D3DXVECTOR3 *v, const D3DVIEWPORT9 *viewport, const D3DXMATRIX *m)
+{
+    *out = *v;
+    if (viewport)
+    {
+        out->x = 2.0f * (out->x - viewport->X) / viewport->Width - 1.0f;
+        out->y = 1.0f - 2.0f * (out->y - viewport->Y) / viewport->Height;
+        out->z = (out->z - viewport->MinZ) / (viewport->MaxZ - viewport->MinZ);
+    }
+    D3DXVec3TransformCoord(out, out, m);
+}
+
 D3DXVECTOR3 * WINAPI D3DXVec3Unproject(D3DXVECTOR3 *out, const D3DXVECTOR3 *v,
         const D3DVIEWPORT9 *viewport, const D3DXMATRIX *projection, const D3DXMATRIX *view,
         const D3DXMATRIX *world)
@@ -1962,38 +1987,29 @@ D3DXVECTOR3 * WINAPI D3DXVec3Unproject(D3DXVECTOR3 *out, const D3DXVECTOR3 *v,
     TRACE("out %p, v %p, viewport %p, projection %p, view %p, world %p.\n",
             out, v, viewport, projection, view, world);
 
-    D3DXMatrixIdentity(&m);
-    if (world)
-        D3DXMatrixMultiply(&m, &m, world);
-    if (view)
-        D3DXMatrixMultiply(&m, &m, view);
-    if (projection)
-        D3DXMatrixMultiply(&m, &m, projection);
+    get_projection_matrix(&m, projection, view, world);
     D3DXMatrixInverse(&m, NULL, &m);
-
-    *out = *v;
-    if (viewport)
-    {
-        out->x = 2.0f * (out->x - viewport->X) / viewport->Width - 1.0f;
-        out->y = 1.0f - 2.0f * (out->y - viewport->Y) / viewport->Height;
-        out->z = (out->z - viewport->MinZ) / (viewport->MaxZ - viewport->MinZ);
-    }
-    D3DXVec3TransformCoord(out, out, &m);
+    unproject_vector(out, v, viewport, &m);
     return out;
 }
 
 D3DXVECTOR3* WINAPI D3DXVec3UnprojectArray(D3DXVECTOR3* out, UINT outstride, const D3DXVECTOR3* in, UINT instride, const D3DVIEWPORT9* viewport, const D3DXMATRIX* projection, const D3DXMATRIX* view, const D3DXMATRIX* world, UINT elements)
 {
+    D3DXMATRIX m;
     UINT i;
 
     TRACE("out %p, outstride %u, in %p, instride %u, viewport %p, projection %p, view %p, world %p, elements %u\n",
         out, outstride, in, instride, viewport, projection, view, world, elements);
 
+    /* the inverse matrix is the same for all the elements */
+    get_projection_matrix(&m, projection, view, world);
+    D3DXMatrixInverse(&m, NULL, &m);
+
     for (i = 0; i < elements; ++i) {
-        D3DXVec3Unproject(
+        unproject_vector(
             (D3DXVECTOR3*)((char*)out + outstride * i),
             (const D3DXVECTOR3*)((const char*)in + instride * i),
-            viewport, projection, view, world);
+            viewport, &m);
     }
     return out;
 }
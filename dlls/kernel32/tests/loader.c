@@ -1854,6 +1854,103 @@ static void test_VirtualProtect(void *base, void *section)
     ok(ret, "VirtualProtect error %ld\n", GetLastError());
 }
 
+/* check in a new process that the image information of a section matches the file headers */
+static void test_image_cache_child( const char *dll_name )
+{
+    SECTION_IMAGE_INFORMATION image;
+    IMAGE_DOS_HEADER dos;
+    IMAGE_NT_HEADERS nt;
+    NTSTATUS status;
+    HANDLE file, mapping;
+    DWORD size;
+    BOOL ret;
+
+    file = CreateFileA( dll_name, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, 0, 0 );
+    ok( file != INVALID_HANDLE_VALUE, "CreateFile error %ld\n", GetLastError() );
+    ret = ReadFile( file, &dos, sizeof(dos), &size, NULL );
+    ok( ret && size == sizeof(dos), "ReadFile error %ld\n", GetLastError() );
+    SetFilePointer( file, dos.e_lfanew, NULL, FILE_BEGIN );
+    ret = ReadFile( file, &nt, sizeof(nt), &size, NULL );
+    ok( ret && size == sizeof(nt), "ReadFile error %ld\n", GetLastError() );
+
+    status = pNtCreateSection( &mapping, STANDARD_RIGHTS_REQUIRED | SECTION_MAP_READ | SECTION_QUERY,
+                               NULL, NULL, PAGE_READONLY, SEC_IMAGE, file );
+    ok( !status, "NtCreateSection failed err %lx\n", status );
+    status = pNtQuerySection( mapping, SectionImageInformation, &image, sizeof(image), NULL );
+    ok( !status, "NtQuerySection failed err %lx\n", status );
+    ok( image.TransferAddress == (char *)nt.OptionalHeader.ImageBase + nt.OptionalHeader.AddressOfEntryPoint,
+        "wrong entry point %p\n", image.TransferAddress );
+    ok( image.SubSystemType == nt.OptionalHeader.Subsystem, "wrong subsystem %lu\n", image.SubSystemType );
+    ok( image.MajorSubsystemVersion == nt.OptionalHeader.MajorSubsystemVersion,
+        "wrong subsystem version %u\n", image.MajorSubsystemVersion );
+    CloseHandle( mapping );
+    CloseHandle( file );
+}
+
+static void run_image_cache_child( const char *dll_name )
+{
+    STARTUPINFOA si = { sizeof(si) };
+    PROCESS_INFORMATION pi;
+    char cmdline[MAX_PATH * 2];
+    char **argv;
+    BOOL ret;
+
+    winetest_get_mainargs( &argv );
+    sprintf( cmdline, "\"%s\" loader image_cache %s", argv[0], dll_name );
+    ret = CreateProcessA( argv[0], cmdline, NULL, NULL, FALSE, 0, NULL, NULL, &si, &pi );
+    ok( ret, "CreateProcess(%s) error %ld\n", cmdline, GetLastError() );
+    wait_child_process( pi.hProcess );
+    CloseHandle( pi.hThread );
+    CloseHandle( pi.hProcess );
+}
+
+/* the server caches image information across processes, make sure it notices rewritten files */
+static void test_image_cache(void)
+{
+    char dll_name[MAX_PATH], dll_name2[MAX_PATH];
+    IMAGE_NT_HEADERS nt_header = nt_header_template;
+    IMAGE_SECTION_HEADER orig_section = section;
+    BOOL ret;
+
+    nt_header.OptionalHeader.SectionAlignment = page_size;
+    nt_header.OptionalHeader.FileAlignment = page_size;
+    nt_header.OptionalHeader.SizeOfHeaders = sizeof(dos_header) + sizeof(nt_header) + sizeof(IMAGE_SECTION_HEADER);
+    nt_header.OptionalHeader.SizeOfImage = sizeof(dos_header) + sizeof(nt_header) + sizeof(IMAGE_SECTION_HEADER) + page_size;
+    nt_header.OptionalHeader.AddressOfEntryPoint = page_size;
+    nt_header.OptionalHeader.Subsystem = IMAGE_SUBSYSTEM_WINDOWS_CUI;
+
+    section.SizeOfRawData = sizeof(section_data);
+    section.PointerToRawData = page_size;
+    section.VirtualAddress = page_size;
+    section.Misc.VirtualSize = page_size;
+    section.Characteristics = IMAGE_SCN_CNT_CODE | IMAGE_SCN_MEM_READ | IMAGE_SCN_MEM_EXECUTE;
+
+    create_test_dll_sections( &dos_header, &nt_header, &section, section_data, dll_name );
+    run_image_cache_child( dll_name );
+    run_image_cache_child( dll_name );
+
+    /* same size and inode, different headers */
+    nt_header.OptionalHeader.AddressOfEntryPoint = page_size + 0x10;
+    nt_header.OptionalHeader.Subsystem = IMAGE_SUBSYSTEM_WINDOWS_GUI;
+    nt_header.OptionalHeader.MajorSubsystemVersion = 5;
+    create_test_dll_sections( &dos_header, &nt_header, &section, section_data, dll_name2 );
+    ret = CopyFileA( dll_name2, dll_name, FALSE );
+    ok( ret, "CopyFile error %ld\n", GetLastError() );
+    run_image_cache_child( dll_name );
+    run_image_cache_child( dll_name );
+
+    /* deleted and recreated, possibly with the same inode */
+    DeleteFileA( dll_name );
+    nt_header.OptionalHeader.AddressOfEntryPoint = page_size + 0x20;
+    nt_header.OptionalHeader.MajorSubsystemVersion = 6;
+    create_test_dll_sections( &dos_header, &nt_header, &section, section_data, dll_name );
+    run_image_cache_child( dll_name );
+
+    DeleteFileA( dll_name );
+    DeleteFileA( dll_name2 );
+    section = orig_section;
+}
+
 static void test_section_access(void)
 {
     static const struct test_data
@@ -4831,6 +4928,11 @@ START_TEST(loader)
         *child_failures = -1;
 
     argc = winetest_get_mainargs(&argv);
+    if (argc > 3 && !strcmp( argv[2], "image_cache" ))
+    {
+        test_image_cache_child( argv[3] );
+        return;
+    }
     if (argc > 4)
     {
         test_dll_phase = atoi(argv[4]);
@@ -4850,6 +4952,7 @@ START_TEST(loader)
     test_ResolveDelayLoadedAPI();
     test_ImportDescriptors();
     test_section_access();
+    test_image_cache();
     test_import_resolution();
     test_export_forwarder_dep_chain();
     test_ExitProcess();
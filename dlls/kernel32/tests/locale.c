@@ -2313,6 +2313,100 @@ static void test_CompareStringEx(void)
 
 }
 
+static void test_CompareStringEx_prefix(void)
+{
+    static const struct
+    {
+        const WCHAR *first;
+        const WCHAR *second;
+    } tails[] =
+    {
+        { L"'s", L"s" },
+        { L"co-op", L"coop" },
+        { L"a-b", L"a'b" },
+        { L"e\x0301", L"\x00e9" },
+        { L"e\x0301x", L"ex" },
+        { L"\x0301", L"" },
+        { L"-", L"'" },
+        { L"A'", L"a-" },
+        { L"a\x0308", L"A\x0308" },
+        { L"x-", L"-x" },
+    };
+    static const DWORD flags[] =
+    {
+        0, NORM_IGNORECASE, NORM_IGNORENONSPACE, NORM_IGNORESYMBOLS, SORT_STRINGSORT,
+        NORM_IGNORECASE | NORM_IGNORENONSPACE | NORM_IGNORESYMBOLS,
+    };
+    /* prefixes from one character to beyond 8192 characters */
+    static const int prefix_lens[] = { 1, 2, 3, 64, 8190, 8191, 8192, 8200 };
+    static const char prefix_chars[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJ0123456789";
+    const int max_len = 8200 + 8, key_size = 16 * 8300;
+    int ret, expect, ref[ARRAY_SIZE(tails)][ARRAY_SIZE(flags)];
+    int i, j, k, len, len1, len2, key_len1, key_len2;
+    WCHAR *str1, *str2;
+    BYTE *key1, *key2;
+
+    if (!pCompareStringEx || !pLCMapStringEx)
+    {
+        win_skip("CompareStringEx or LCMapStringEx not supported\n");
+        return;
+    }
+
+    str1 = HeapAlloc(GetProcessHeap(), 0, max_len * sizeof(WCHAR));
+    str2 = HeapAlloc(GetProcessHeap(), 0, max_len * sizeof(WCHAR));
+    key1 = HeapAlloc(GetProcessHeap(), 0, key_size);
+    key2 = HeapAlloc(GetProcessHeap(), 0, key_size);
+
+    for (i = 0; i < ARRAY_SIZE(prefix_lens); i++)
+    {
+        len = prefix_lens[i];
+        for (k = 0; k < len; k++) str1[k] = str2[k] = prefix_chars[k % strlen(prefix_chars)];
+
+        /* identical strings */
+        ret = pCompareStringEx(L"en-US", 0, str1, len, str2, len, NULL, NULL, 0);
+        ok(ret == CSTR_EQUAL, "%d: got %d\n", len, ret);
+
+        for (j = 0; j < ARRAY_SIZE(tails); j++)
+        {
+            len1 = len + wcslen(tails[j].first);
+            len2 = len + wcslen(tails[j].second);
+            memcpy(str1 + len, tails[j].first, wcslen(tails[j].first) * sizeof(WCHAR));
+            memcpy(str2 + len, tails[j].second, wcslen(tails[j].second) * sizeof(WCHAR));
+
+            for (k = 0; k < ARRAY_SIZE(flags); k++)
+            {
+                winetest_push_context("%d %s %s %#lx", len, debugstr_w(tails[j].first),
+                                      debugstr_w(tails[j].second), flags[k]);
+
+                ret = pCompareStringEx(L"en-US", flags[k], str1, len1, str2, len2, NULL, NULL, 0);
+
+                /* the result has to agree with the sort keys of the whole strings */
+                key_len1 = pLCMapStringEx(L"en-US", LCMAP_SORTKEY | flags[k], str1, len1,
+                                          (WCHAR *)key1, key_size, NULL, NULL, 0);
+                ok(key_len1 > 0, "LCMapStringEx failed, error %lu\n", GetLastError());
+                key_len2 = pLCMapStringEx(L"en-US", LCMAP_SORTKEY | flags[k], str2, len2,
+                                          (WCHAR *)key2, key_size, NULL, NULL, 0);
+                ok(key_len2 > 0, "LCMapStringEx failed, error %lu\n", GetLastError());
+                expect = memcmp(key1, key2, min(key_len1, key_len2));
+                if (!expect) expect = key_len1 - key_len2;
+                expect = expect < 0 ? CSTR_LESS_THAN : expect > 0 ? CSTR_GREATER_THAN : CSTR_EQUAL;
+                ok(ret == expect, "got %d, expected %d\n", ret, expect);
+
+                /* and it doesn't depend on the length of the prefix */
+                if (!i) ref[j][k] = ret;
+                else ok(ret == ref[j][k], "got %d, expected %d\n", ret, ref[j][k]);
+
+                winetest_pop_context();
+            }
+        }
+    }
+
+    HeapFree(GetProcessHeap(), 0, str1);
+    HeapFree(GetProcessHeap(), 0, str2);
+    HeapFree(GetProcessHeap(), 0, key1);
+    HeapFree(GetProcessHeap(), 0, key2);
+}
+
 static const DWORD lcmap_invalid_flags[] = {
     0,
     LCMAP_HIRAGANA | LCMAP_KATAKANA,
@@ -8705,6 +8799,7 @@ START_TEST(locale)
   test_CompareStringA();
   test_CompareStringW();
   test_CompareStringEx();
+  test_CompareStringEx_prefix();
   test_LCMapStringA();
   test_LCMapStringW();
   test_LCMapStringEx();
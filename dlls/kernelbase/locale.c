@@ -3826,6 +3826,19 @@ static int get_sortkey( const struct sortguid *sortid, DWORD flags,
 }
 
 
+/* check if a character only contributes fixed normal weights that don't depend on its neighbours */
+static BOOL is_context_free_char( WCHAR c, UINT except, DWORD flags )
+{
+    union char_weights weights;
+
+    if (c >= 0x80) return FALSE;
+    weights = get_char_weights( c, except );
+    if (weights._case & CASE_COMPR_6) return FALSE;
+    if (weights.script == SCRIPT_DIGIT) return !(flags & SORT_DIGITSASNUMBERS);
+    return weights.script == SCRIPT_LATIN;
+}
+
+
 /* implementation of CompareStringEx */
 static int compare_string( const struct sortguid *sortid, DWORD flags,
                            const WCHAR *src1, int srclen1, const WCHAR *src2, int srclen2 )
@@ -3846,6 +3859,25 @@ static int compare_string( const struct sortguid *sortid, DWORD flags,
     if (flags & NORM_IGNOREKANATYPE) case_mask &= ~CASE_KATAKANA;
     if ((flags & NORM_LINGUISTIC_CASING) && except && sortid->ling_except) except = sortid->ling_except;
 
+    if (srclen1 == srclen2 && !memcmp( src1, src2, srclen1 * sizeof(WCHAR) )) return 0;
+
+    /* A common prefix of context-free characters adds the same weights to the start of each
+     * key, so it can be skipped. The last character of the prefix is kept for following
+     * nonspace marks and kana to refer to. Reversed diacritics would move the prefix to the
+     * end of the key, and longer strings could overflow the position of special weights. */
+    if (!(sortid->flags & FLAG_REVERSEDIACRITICS) && srclen1 < 8192 && srclen2 < 8192)
+    {
+        for (i = 0; i < srclen1 && i < srclen2 && src1[i] == src2[i]; i++)
+            if (!is_context_free_char( src1[i], except, flags )) break;
+        if (i > 1)
+        {
+            src1 += i - 1;
+            src2 += i - 1;
+            srclen1 -= i - 1;
+            srclen2 -= i - 1;
+        }
+    }
+
     init_sortkey_state( &s1, flags, srclen1, primary1, sizeof(primary1) );
     init_sortkey_state( &s2, flags, srclen2, primary2, sizeof(primary2) );
 
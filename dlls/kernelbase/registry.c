@@ -1641,7 +1641,7 @@ LSTATUS WINAPI DECLSPEC_HOTPATCH RegQueryValueExW( HKEY hkey, LPCWSTR name, LPDW
     NTSTATUS status;
     UNICODE_STRING name_str;
     DWORD total_size;
-    char buffer[256], *buf_ptr = buffer;
+    char buffer[1024], *buf_ptr = buffer;  /* large enough for paths without a second request */
     KEY_VALUE_PARTIAL_INFORMATION *info = (KEY_VALUE_PARTIAL_INFORMATION *)buffer;
     static const int info_size = offsetof( KEY_VALUE_PARTIAL_INFORMATION, Data );
 
@@ -1666,7 +1666,7 @@ LSTATUS WINAPI DECLSPEC_HOTPATCH RegQueryValueExW( HKEY hkey, LPCWSTR name, LPDW
     }
 
     status = NtQueryValueKey( hkey, &name_str, KeyValuePartialInformation,
-                              buffer, total_size, &total_size );
+                              buf_ptr, total_size, &total_size );
     if (status && status != STATUS_BUFFER_OVERFLOW) goto done;
 
     if (data)
@@ -155,6 +155,7 @@ typedef struct {
     HANDLE *shutdown_events;
     CRITICAL_SECTION cs;
     struct list scheduled_chores;
+    struct list collection_chores;
 } ThreadScheduler;
 extern const vtable_ptr ThreadScheduler_vtable;
 
@@ -220,8 +221,18 @@ typedef struct _UnrealizedChore
     void *unk[6];
 } _UnrealizedChore;
 
+/* chores scheduled by a single task collection, so that its owner doesn't
+ * need to search the scheduler list for them while waiting */
+struct collection_chores {
+    struct list entry;
+    _StructuredTaskCollection *task_collection;
+    struct list chores;
+};
+
 struct scheduled_chore {
     struct list entry;
+    struct list collection_entry;
+    struct collection_chores *collection;
     _UnrealizedChore *chore;
 };
 
@@ -1056,6 +1067,32 @@ int __thiscall ExternalContextBase_GetContextKind(const ExternalContextBase *thi
     return 0;
 }
 
+/* scheduler->cs must be held */
+static struct collection_chores *find_collection_chores(ThreadScheduler *scheduler,
+        _StructuredTaskCollection *task_collection)
+{
+    struct collection_chores *cc;
+
+    LIST_FOR_EACH_ENTRY(cc, &scheduler->collection_chores, struct collection_chores, entry)
+    {
+        if (cc->task_collection == task_collection)
+            return cc;
+    }
+    return NULL;
+}
+
+/* scheduler->cs must be held, sc needs to be freed by the caller */
+static void unlink_scheduled_chore(struct scheduled_chore *sc)
+{
+    list_remove(&sc->entry);
+    list_remove(&sc->collection_entry);
+    if (list_empty(&sc->collection->chores))
+    {
+        list_remove(&sc->collection->entry);
+        operator_delete(sc->collection);
+    }
+}
+
 static void remove_scheduled_chores(Scheduler *scheduler, const ExternalContextBase *context)
 {
     ThreadScheduler *tscheduler = (ThreadScheduler*)scheduler;
@@ -1068,7 +1105,7 @@ static void remove_scheduled_chores(Scheduler *scheduler, const ExternalContextB
     LIST_FOR_EACH_ENTRY_SAFE(sc, next, &tscheduler->scheduled_chores,
                              struct scheduled_chore, entry) {
         if (sc->chore->task_collection->context == &context->context) {
-            list_remove(&sc->entry);
+            unlink_scheduled_chore(sc);
             operator_delete(sc);
         }
     }
@@ -1417,7 +1454,10 @@ static void ThreadScheduler_dtor(ThreadScheduler *this)
         ERR("scheduled chore list is not empty\n");
     LIST_FOR_EACH_ENTRY_SAFE(sc, next, &this->scheduled_chores,
             struct scheduled_chore, entry)
+    {
+        unlink_scheduled_chore(sc);
         operator_delete(sc);
+    }
 }
 
 DEFINE_THISCALL_WRAPPER(ThreadScheduler_Id, 4)
@@ -1649,6 +1689,7 @@ static ThreadScheduler* ThreadScheduler_ctor(ThreadScheduler *this,
     this->cs.DebugInfo->Spare[0] = (DWORD_PTR)(__FILE__ ": ThreadScheduler");
 
     list_init(&this->scheduled_chores);
+    list_init(&this->collection_chores);
     return this;
 }
 
@@ -2132,8 +2173,9 @@ void __thiscall _StructuredTaskCollection__Cancel(
 {
     ThreadScheduler *scheduler;
     void *prev_exception, *new_exception;
-    struct scheduled_chore *sc, *next;
-    LONG removed = 0, finished = 1;
+    struct collection_chores *cc;
+    struct scheduled_chore *sc;
+    LONG removed = 0, finished = 1, i;
     struct beacon *beacon;
 
     TRACE("(%p)\n", this);
@@ -2163,14 +2205,15 @@ void __thiscall _StructuredTaskCollection__Cancel(
     LeaveCriticalSection(&((ExternalContextBase*)this->context)->beacons_cs);
 
     EnterCriticalSection(&scheduler->cs);
-    LIST_FOR_EACH_ENTRY_SAFE(sc, next, &scheduler->scheduled_chores,
-                             struct scheduled_chore, entry) {
-        if (sc->chore->task_collection != this)
-            continue;
-        sc->chore->task_collection = NULL;
-        list_remove(&sc->entry);
-        removed++;
-        operator_delete(sc);
+    if ((cc = find_collection_chores(scheduler, this))) {
+        /* the collection entry is freed together with its last chore */
+        removed = list_count(&cc->chores);
+        for (i = 0; i < removed; i++) {
+            sc = LIST_ENTRY(list_head(&cc->chores), struct scheduled_chore, collection_entry);
+            sc->chore->task_collection = NULL;
+            unlink_scheduled_chore(sc);
+            operator_delete(sc);
+        }
     }
     LeaveCriticalSection(&scheduler->cs);
     if (!removed)
@@ -2280,13 +2323,19 @@ static void __cdecl chore_wrapper(_UnrealizedChore *chore)
     __FINALLY_CTX(chore_wrapper_finally, chore)
 }
 
-static BOOL pick_and_execute_chore(ThreadScheduler *scheduler)
+/* Chores are added at the head of the lists. A waiting collection owner runs
+ * its own most recently scheduled chores from its collection list, while
+ * worker threads take the oldest chore from the tail of the scheduler list,
+ * so that they pick up the largest pieces of work and rarely contend with
+ * the owner for the same entries. */
+static BOOL pick_and_execute_chore(ThreadScheduler *scheduler,
+        _StructuredTaskCollection *task_collection)
 {
-    struct list *entry;
+    struct collection_chores *cc;
     struct scheduled_chore *sc;
-    _UnrealizedChore *chore;
+    _UnrealizedChore *chore = NULL;
 
-    TRACE("(%p)\n", scheduler);
+    TRACE("(%p %p)\n", scheduler, task_collection);
 
     if (scheduler->scheduler.vtable != &ThreadScheduler_vtable)
     {
@@ -2295,15 +2344,25 @@ static BOOL pick_and_execute_chore(ThreadScheduler *scheduler)
     }
 
     EnterCriticalSection(&scheduler->cs);
-    entry = list_head(&scheduler->scheduled_chores);
-    if (entry)
-        list_remove(entry);
+    if (task_collection)
+    {
+        if ((cc = find_collection_chores(scheduler, task_collection)))
+        {
+            sc = LIST_ENTRY(list_head(&cc->chores), struct scheduled_chore, collection_entry);
+            chore = sc->chore;
+        }
+    }
+    else if (!list_empty(&scheduler->scheduled_chores))
+    {
+        sc = LIST_ENTRY(list_tail(&scheduler->scheduled_chores), struct scheduled_chore, entry);
+        chore = sc->chore;
+    }
+    if (chore)
+        unlink_scheduled_chore(sc);
     LeaveCriticalSection(&scheduler->cs);
-    if (!entry)
+    if (!chore)
         return FALSE;
 
-    sc = LIST_ENTRY(entry, struct scheduled_chore, entry);
-    chore = sc->chore;
     operator_delete(sc);
 
     chore->chore_wrapper(chore);
@@ -2312,12 +2371,13 @@ static BOOL pick_and_execute_chore(ThreadScheduler *scheduler)
 
 static void __cdecl _StructuredTaskCollection_scheduler_cb(void *data)
 {
-    pick_and_execute_chore((ThreadScheduler*)get_current_scheduler());
+    pick_and_execute_chore((ThreadScheduler*)get_current_scheduler(), NULL);
 }
 
 static bool schedule_chore(_StructuredTaskCollection *this,
         _UnrealizedChore *chore, Scheduler **pscheduler)
 {
+    struct collection_chores *cc, *new_cc = NULL;
     struct scheduled_chore *sc;
     ThreadScheduler *scheduler;
 
@@ -2339,13 +2399,32 @@ static bool schedule_chore(_StructuredTaskCollection *this,
     sc = operator_new(sizeof(*sc));
     sc->chore = chore;
 
+    EnterCriticalSection(&scheduler->cs);
+    while (!(cc = find_collection_chores(scheduler, this)) && !new_cc)
+    {
+        /* operator_new may throw, don't allocate while holding the lock */
+        LeaveCriticalSection(&scheduler->cs);
+        new_cc = operator_new(sizeof(*new_cc));
+        EnterCriticalSection(&scheduler->cs);
+    }
+    if (!cc)
+    {
+        cc = new_cc;
+        new_cc = NULL;
+        cc->task_collection = this;
+        list_init(&cc->chores);
+        list_add_head(&scheduler->collection_chores, &cc->entry);
+    }
+
     chore->task_collection = this;
     chore->chore_wrapper = chore_wrapper;
     InterlockedIncrement(&this->count);
 
-    EnterCriticalSection(&scheduler->cs);
+    sc->collection = cc;
+    list_add_head(&cc->chores, &sc->collection_entry);
     list_add_head(&scheduler->scheduled_chores, &sc->entry);
     LeaveCriticalSection(&scheduler->cs);
+    operator_delete(new_cc);
     *pscheduler = &scheduler->scheduler;
     return TRUE;
 }
@@ -2425,7 +2504,7 @@ _TaskCollectionStatus __stdcall _StructuredTaskCollection__RunAndWait(
     if (this->context) {
         ThreadScheduler *scheduler = get_thread_scheduler_from_context(this->context);
         if (scheduler) {
-            while (pick_and_execute_chore(scheduler)) ;
+            while (pick_and_execute_chore(scheduler, this)) ;
         }
     }
 
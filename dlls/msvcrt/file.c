@@ -3037,6 +3037,21 @@ static int read_i(int fd, ioinfo *fdinfo, void *buf, unsigned int count)
 
             for (i=0, j=0; i<num_read; i+=1+utf16)
             {
+                if (!utf16)
+                {
+                    DWORD k;
+
+                    /* move runs of characters that need no translation at once */
+                    for (k = i; k < num_read && bufstart[k] != '\r' && bufstart[k] != 0x1a; k++);
+                    if (k != i)
+                    {
+                        if (j != i) memmove(bufstart + j, bufstart + i, k - i);
+                        j += k - i;
+                        i = k;
+                        if (i == num_read) break;
+                    }
+                }
+
                 /* in text mode, a ctrl-z signals EOF */
                 if (bufstart[i]==0x1a && (!utf16 || bufstart[i+1]==0))
                 {
@@ -3904,16 +3919,32 @@ int CDECL _fgetchar(void)
  */
 char * CDECL fgets(char *s, int size, FILE* file)
 {
-  int    cc = EOF;
+  int    cc = EOF, cnt;
   char * buf_start = s;
+  char * nl;
 
   TRACE(":file(%p) fd (%d) str (%p) len (%d)\n",
 	file,file->_file,s,size);
 
   _lock_file(file);
 
-  while ((size >1) && (cc = _fgetc_nolock(file)) != EOF && cc != '\n')
+  while (size > 1)
     {
+      if (file->_cnt > 0)
+        {
+          /* copy buffered data up to the next newline in one go */
+          cnt = (file->_cnt < size - 1) ? file->_cnt : size - 1;
+          if ((nl = memchr(file->_ptr, '\n', cnt)))
+            cnt = nl - file->_ptr;
+          memcpy(s, file->_ptr, cnt);
+          file->_ptr += cnt;
+          file->_cnt -= cnt;
+          s += cnt;
+          size -= cnt;
+          if (!nl) continue;
+        }
+      if ((cc = _fgetc_nolock(file)) == EOF || cc == '\n')
+        break;
       *s++ = (char)cc;
       size --;
     }
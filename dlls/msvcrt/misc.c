@@ -256,8 +256,27 @@ void CDECL _chkesp(void)
 
 static inline void swap(char *l, char *r, size_t size)
 {
+    typedef ULONGLONG DECLSPEC_ALIGN(1) unaligned_ui64;
+    typedef DWORD DECLSPEC_ALIGN(1) unaligned_ui32;
+    ULONGLONG tmp64;
+    DWORD tmp32;
     char tmp;
 
+    for(; size >= sizeof(tmp64); size -= sizeof(tmp64)) {
+        tmp64 = *(unaligned_ui64*)l;
+        *(unaligned_ui64*)l = *(unaligned_ui64*)r;
+        *(unaligned_ui64*)r = tmp64;
+        l += sizeof(tmp64);
+        r += sizeof(tmp64);
+    }
+    if(size >= sizeof(tmp32)) {
+        tmp32 = *(unaligned_ui32*)l;
+        *(unaligned_ui32*)l = *(unaligned_ui32*)r;
+        *(unaligned_ui32*)r = tmp32;
+        l += sizeof(tmp32);
+        r += sizeof(tmp32);
+        size -= sizeof(tmp32);
+    }
     while(size--) {
         tmp = *l;
         *l++ = *r;
@@ -284,26 +303,63 @@ static void small_sort(void *base, size_t nmemb, size_t size,
     }
 }
 
+static void heap_sort(void *base, size_t nmemb, size_t size,
+        int (CDECL *compar)(void *, const void *, const void *), void *context)
+{
+    size_t e, i, parent, child;
+
+#define X(i) ((char*)base+size*(i))
+    for(e=nmemb, i=nmemb/2; e>1;) {
+        if(i) {
+            parent = --i;
+        }else {
+            swap(X(0), X(--e), size);
+            parent = 0;
+        }
+
+        while((child = 2*parent+1) < e) {
+            if(child+1 < e && compar(context, X(child+1), X(child)) > 0)
+                child++;
+            if(compar(context, X(child), X(parent)) <= 0)
+                break;
+            swap(X(parent), X(child), size);
+            parent = child;
+        }
+    }
+#undef X
+}
+
 static void quick_sort(void *base, size_t nmemb, size_t size,
         int (CDECL *compar)(void *, const void *, const void *), void *context)
 {
     size_t stack_lo[8*sizeof(size_t)], stack_hi[8*sizeof(size_t)];
+    unsigned int stack_depth[8*sizeof(size_t)], depth, max_depth;
     size_t beg, end, lo, hi, med;
     int stack_pos;
 
+    /* fall back to heap sort on inputs that make partitioning degenerate */
+    for(max_depth=0; nmemb>>max_depth > 1; max_depth++);
+    max_depth *= 2;
+
     stack_pos = 0;
     stack_lo[stack_pos] = 0;
     stack_hi[stack_pos] = nmemb-1;
+    stack_depth[stack_pos] = 0;
 
 #define X(i) ((char*)base+size*(i))
     while(stack_pos >= 0) {
         beg = stack_lo[stack_pos];
-        end = stack_hi[stack_pos--];
+        end = stack_hi[stack_pos];
+        depth = stack_depth[stack_pos--];
 
         if(end-beg < 8) {
             small_sort(X(beg), end-beg+1, size, compar, context);
             continue;
         }
+        if(depth++ == max_depth) {
+            heap_sort(X(beg), end-beg+1, size, compar, context);
+            continue;
+        }
 
         lo = beg;
         hi = end;
@@ -349,13 +405,17 @@ static void quick_sort(void *base, size_t nmemb, size_t size,
         if(hi-beg >= end-lo) {
             stack_lo[++stack_pos] = beg;
             stack_hi[stack_pos] = hi;
+            stack_depth[stack_pos] = depth;
             stack_lo[++stack_pos] = lo;
             stack_hi[stack_pos] = end;
+            stack_depth[stack_pos] = depth;
         }else {
             stack_lo[++stack_pos] = lo;
             stack_hi[stack_pos] = end;
+            stack_depth[stack_pos] = depth;
             stack_lo[++stack_pos] = beg;
             stack_hi[stack_pos] = hi;
+            stack_depth[stack_pos] = depth;
         }
     }
 #undef X
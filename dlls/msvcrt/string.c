@@ -740,6 +740,54 @@ static inline BOOL bnum_to_mant(struct bnum *b, ULONGLONG *m)
     return TRUE;
 }
 
+/* Divides hi * 2^64 + lo by d, hi needs to be smaller than d */
+static inline ULONGLONG div_u128(ULONGLONG hi, ULONGLONG lo, ULONGLONG d, ULONGLONG *rem)
+{
+    ULONGLONG q = 0;
+    int i;
+
+    for(i=0; i<64; i++) {
+        hi = (hi << 1) | (lo >> 63);
+        lo <<= 1;
+        q <<= 1;
+        if(hi >= d) {
+            hi -= d;
+            q |= 1;
+        }
+    }
+    *rem = hi;
+    return q;
+}
+
+/* Converts m * 10^e to binary without using bnum, when it can be done exactly */
+/* Return FALSE if the number is out of range */
+static BOOL fpnum_from_dec(int sign, ULONGLONG m, int e, struct fpnum *ret)
+{
+    ULONGLONG d = 1, q, r;
+    int i, t, u;
+
+    if(e < -27 || e > 27) return FALSE; /* 5^27 is the biggest power of 5 below 2^63 */
+    for(i=0; i<e || i<-e; i++) d *= 5;
+
+    if(e >= 0) {
+        if(m > UI64_MAX / d) return FALSE;
+        *ret = fpnum(sign, e, m * d, FP_ROUND_ZERO);
+        return TRUE;
+    }
+
+    /* m * 10^e == (m * 2^(t+u) / 5^-e) * 2^(e-t-u); with m >= 2^63 and
+     * 2^u <= 5^-e < 2^(u+1), the quotient is only guaranteed to be >= 2^62,
+     * its top bit may be clear and fpnum() normalizes it */
+    for(t=0; !(m >> 63); t++) m <<= 1;
+    for(u=0; d >> (u+1); u++);
+    q = div_u128(m >> (64-u), m << u, d, &r);
+
+    if(!r) *ret = fpnum(sign, e-t-u, q, FP_ROUND_ZERO);
+    else if(r < d - r) *ret = fpnum(sign, e-t-u, q, FP_ROUND_DOWN);
+    else *ret = fpnum(sign, e-t-u, q, FP_ROUND_UP); /* d is odd, can't be a tie */
+    return TRUE;
+}
+
 static struct fpnum fpnum_parse_bnum(wchar_t (*get)(void *ctx), void (*unget)(void *ctx),
         void *ctx, pthreadlocinfo locinfo, BOOL ldouble, struct bnum *b)
 {
@@ -915,6 +963,20 @@ static struct fpnum fpnum_parse_bnum(wchar_t (*get)(void *ctx), void (*unget)(vo
     if(!b->data[bnum_idx(b, b->e-1)])
         return fpnum(sign, 0, 0, 0);
 
+    /* Short numbers with small exponents don't need bnum arithmetic */
+    if(!ldouble && b->e-b->b <= 2 && dp > INT_MIN + 2*LIMB_DIGITS) {
+        struct fpnum ret;
+
+        if(b->b == b->e-1) {
+            m = b->data[bnum_idx(b, b->b)];
+            i = limb_digits;
+        } else {
+            m = (ULONGLONG)b->data[bnum_idx(b, b->e-1)] * p10s[limb_digits] + b->data[bnum_idx(b, b->b)];
+            i = LIMB_DIGITS + limb_digits;
+        }
+        if(fpnum_from_dec(sign, m, dp - i, &ret)) return ret;
+    }
+
     /* Fill last limb with 0 if needed */
     if(b->b+1 != b->e) {
         for(; limb_digits != LIMB_DIGITS; limb_digits++)
@@ -1559,13 +1621,26 @@ int CDECL _atoldbl(_LDOUBLE *value, char *str)
     return _atoldbl_l( value, str, NULL );
 }
 
+#define WORD_ONES (~(size_t)0 / 0xff)
+
+/* Returns non-zero if any byte of v is zero. Callers only use it on aligned
+ * words so that reading past the terminator never crosses a page boundary. */
+static inline size_t has_zero_byte(size_t v)
+{
+    return (v - WORD_ONES) & ~v & (WORD_ONES << 7);
+}
+
 /*********************************************************************
  *              strlen (MSVCRT.@)
  */
 size_t __cdecl strlen(const char *str)
 {
     const char *s = str;
-    while (*s) s++;
+    const size_t *w;
+
+    for (; (ULONG_PTR)s & (sizeof(size_t) - 1); s++) if (!*s) return s - str;
+    for (w = (const size_t *)s; !has_zero_byte(*w); w++);
+    for (s = (const char *)w; *s; s++);
     return s - str;
 }
 
@@ -3249,11 +3324,20 @@ void *__cdecl memset(void *dst, int c, size_t n)
  */
 char* __cdecl strchr(const char *str, int c)
 {
-    do
+    size_t mask = WORD_ONES * (unsigned char)c;
+    const size_t *w;
+
+    for (; (ULONG_PTR)str & (sizeof(size_t) - 1); str++)
     {
         if (*str == (char)c) return (char*)str;
-    } while (*str++);
-    return NULL;
+        if (!*str) return NULL;
+    }
+    for (w = (const size_t *)str; !has_zero_byte(*w) && !has_zero_byte(*w ^ mask); w++);
+    for (str = (const char *)w;; str++)
+    {
+        if (*str == (char)c) return (char*)str;
+        if (!*str) return NULL;
+    }
 }
 
 /*********************************************************************
@@ -3272,8 +3356,13 @@ char* __cdecl strrchr(const char *str, int c)
 void* __cdecl memchr(const void *ptr, int c, size_t n)
 {
     const unsigned char *p = ptr;
+    size_t mask = WORD_ONES * (unsigned char)c;
+    const size_t *w;
 
-    for (p = ptr; n; n--, p++) if (*p == (unsigned char)c) return (void *)(ULONG_PTR)p;
+    for (; n && ((ULONG_PTR)p & (sizeof(size_t) - 1)); n--, p++)
+        if (*p == (unsigned char)c) return (void *)(ULONG_PTR)p;
+    for (w = (const size_t *)p; n >= sizeof(size_t) && !has_zero_byte(*w ^ mask); n -= sizeof(size_t)) w++;
+    for (p = (const unsigned char *)w; n; n--, p++) if (*p == (unsigned char)c) return (void *)(ULONG_PTR)p;
     return NULL;
 }
 
@@ -3282,6 +3371,17 @@ void* __cdecl memchr(const void *ptr, int c, size_t n)
  */
 int __cdecl strcmp(const char *str1, const char *str2)
 {
+    /* compare word by word when both strings can be aligned together */
+    if (!(((ULONG_PTR)str1 ^ (ULONG_PTR)str2) & (sizeof(size_t) - 1)))
+    {
+        const size_t *w1, *w2;
+
+        while (((ULONG_PTR)str1 & (sizeof(size_t) - 1)) && *str1 && *str1 == *str2) { str1++; str2++; }
+        for (w1 = (const size_t *)str1, w2 = (const size_t *)str2;
+             !((ULONG_PTR)w1 & (sizeof(size_t) - 1)) && *w1 == *w2 && !has_zero_byte(*w1); w1++, w2++);
+        str1 = (const char *)w1;
+        str2 = (const char *)w2;
+    }
     while (*str1 && *str1 == *str2) { str1++; str2++; }
     if ((unsigned char)*str1 > (unsigned char)*str2) return 1;
     if ((unsigned char)*str1 < (unsigned char)*str2) return -1;
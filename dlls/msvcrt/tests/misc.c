@@ -526,6 +526,110 @@ static void test_qsort_s(void)
     p_qsort_s(tab, 100, sizeof(int), qsort_comp, NULL);
     for(i=0; i<100; i++)
         ok(tab[i] == i, "data sorted incorrectly on position %d: %d\n", i, tab[i]);
+
+    /* test that whole elements are moved when they are larger than int */
+    for(i=0; i<99; i++) tab[i] = 32-i/3;
+    p_qsort_s(tab, 33, 3*sizeof(int), qsort_comp, NULL);
+    for(i=0; i<99; i++)
+        ok(tab[i] == i/3, "data sorted incorrectly on position %d: %d\n", i, tab[i]);
+}
+
+/* McIlroy's adversary: values are only fixed when compared, in a way that makes partitioning degenerate */
+struct qsort_adversary
+{
+    int val[1000];
+    int gas;
+    int nsolid;
+    int candidate;
+    int ncmp;
+};
+
+static int __cdecl qsort_adversary_comp(void *ctx, const void *l, const void *r)
+{
+    struct qsort_adversary *adv = ctx;
+    int x = *(int *)l, y = *(int *)r;
+
+    adv->ncmp++;
+    if(adv->val[x] == adv->gas && adv->val[y] == adv->gas) {
+        if(x == adv->candidate) adv->val[x] = adv->nsolid++;
+        else adv->val[y] = adv->nsolid++;
+    }
+    if(adv->val[x] == adv->gas) adv->candidate = x;
+    else if(adv->val[y] == adv->gas) adv->candidate = y;
+    return adv->val[x] - adv->val[y];
+}
+
+static int __cdecl qsort_count_comp(void *ctx, const void *l, const void *r)
+{
+    (*(int *)ctx)++;
+    return *(int *)l - *(int *)r;
+}
+
+static int __cdecl qsort_count_comp64(void *ctx, const void *l, const void *r)
+{
+    LONGLONG a = *(LONGLONG *)l, b = *(LONGLONG *)r;
+
+    (*(int *)ctx)++;
+    return a < b ? -1 : a > b;
+}
+
+static void test_qsort_s_worst_case(void)
+{
+    static struct qsort_adversary adv;
+    static LONGLONG tab64[1000];
+    static int tab[1000];
+    /* about 5 * n * log2(n), a quadratic sort needs more than 250000 comparisons */
+    const int max_cmp = 50000;
+    int i, n = ARRAY_SIZE(tab), ncmp;
+
+    if(!p_qsort_s) {
+        win_skip("qsort_s not available\n");
+        return;
+    }
+
+    adv.gas = n;
+    adv.nsolid = adv.candidate = adv.ncmp = 0;
+    for(i=0; i<n; i++) {
+        tab[i] = i;
+        adv.val[i] = adv.gas;
+    }
+    p_qsort_s(tab, n, sizeof(int), qsort_adversary_comp, &adv);
+    ok(adv.ncmp < max_cmp || broken(1) /* no fallback in native */, "got %d comparisons\n", adv.ncmp);
+    for(i=1; i<n; i++)
+        ok(adv.val[tab[i-1]] <= adv.val[tab[i]], "data sorted incorrectly on position %d\n", i);
+
+    /* replay the input the adversary generated with both int and 64-bit elements */
+    for(i=0; i<n; i++) tab[i] = adv.val[i];
+    ncmp = 0;
+    p_qsort_s(tab, n, sizeof(int), qsort_count_comp, &ncmp);
+    ok(ncmp < max_cmp || broken(1), "got %d comparisons\n", ncmp);
+    for(i=1; i<n; i++)
+        ok(tab[i-1] <= tab[i], "data sorted incorrectly on position %d: %d <= %d\n", i, tab[i-1], tab[i]);
+
+    for(i=0; i<n; i++) tab64[i] = ((LONGLONG)adv.val[i] << 32) | (n-i);
+    ncmp = 0;
+    p_qsort_s(tab64, n, sizeof(LONGLONG), qsort_count_comp64, &ncmp);
+    ok(ncmp < max_cmp || broken(1), "got %d comparisons\n", ncmp);
+    for(i=1; i<n; i++)
+        ok(tab64[i-1] < tab64[i], "data sorted incorrectly on position %d\n", i);
+
+    /* many equal keys */
+    srand(0);
+    for(i=0; i<n; i++) tab[i] = rand()%4;
+    ncmp = 0;
+    p_qsort_s(tab, n, sizeof(int), qsort_count_comp, &ncmp);
+    ok(ncmp < max_cmp, "got %d comparisons\n", ncmp);
+    for(i=1; i<n; i++)
+        ok(tab[i-1] <= tab[i], "data sorted incorrectly on position %d: %d <= %d\n", i, tab[i-1], tab[i]);
+
+    for(i=0; i<n; i++) tab64[i] = ((LONGLONG)(rand()%4) << 32) | 0xdeadbeef;
+    ncmp = 0;
+    p_qsort_s(tab64, n, sizeof(LONGLONG), qsort_count_comp64, &ncmp);
+    ok(ncmp < max_cmp, "got %d comparisons\n", ncmp);
+    for(i=1; i<n; i++)
+        ok(tab64[i-1] <= tab64[i], "data sorted incorrectly on position %d\n", i);
+    for(i=0; i<n; i++)
+        ok((DWORD)tab64[i] == 0xdeadbeef, "element %d was torn\n", i);
 }
 
 static int eq_nan(UINT64 ai, double b)
@@ -768,6 +872,7 @@ START_TEST(misc)
     test__popen(arg_v[0]);
     test__invalid_parameter();
     test_qsort_s();
+    test_qsort_s_worst_case();
     test_math_functions();
     test_thread_handle_close();
     test_thread_suspended();
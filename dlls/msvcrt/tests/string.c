@@ -2166,6 +2166,102 @@ static void test__strtod(void)
     ok(errno == ERANGE, "errno = %x\n", errno);
 }
 
+static unsigned int strtod_seed = 12345;
+
+static ULONGLONG strtod_rand(void)
+{
+    strtod_seed = strtod_seed * 1103515245 + 12345;
+    return strtod_seed >> 8;
+}
+
+static void test_strtod_exact(void)
+{
+    static const struct {
+        const char *str;
+        ULONGLONG bits;
+    } tests[] = {
+        { "0.1", 0x3fb999999999999aull },
+        { "1e23", 0x44b52d02c7e14af6ull },
+        { "9007199254740993", 0x4340000000000000ull },
+        { "9007199254740995", 0x4340000000000002ull },
+        { "4503599627370496.5", 0x4330000000000000ull },
+        { "4503599627370497.5", 0x4330000000000002ull },
+        { "18014398509481986", 0x4350000000000000ull },
+        { "18014398509481990", 0x4350000000000002ull },
+        { "123456789012345678", 0x437b69b4ba630f35ull },
+        { "1234567890123456789", 0x43b12210f47de981ull },
+        { "999999999999999999e-27", 0x3e112e0be826d695ull },
+        { "1e27", 0x4589d971e4fe8402ull },
+        { "1e28", 0x45c027e72f1f1281ull },
+        { "1e-27", 0x3a53ce9a36f23c10ull },
+        { "1e-28", 0x3a1fb0f6be506019ull },
+        { "8.5e-27", 0x3a850b83da615fd1ull },
+        { "0.000000000000000000000000001", 0x3a53ce9a36f23c10ull },
+        { "0.30000000000000004", 0x3fd3333333333334ull },
+        { "2.5e-21", 0x3ba79ca10c924223ull },
+        { "18014398509481987e-3", 0x42b0624dd2f1a9fdull },
+        { "2.2250738585072011e-308", 0x000fffffffffffffull },
+    };
+    static const char zeros[] = "000000000000000000";
+    char str[64], long_str[96];
+    ULONGLONG m, k, bits, long_bits;
+    int i, j, e, digits;
+    double d, expect;
+
+    for (i = 0; i < ARRAY_SIZE(tests); i++)
+    {
+        d = strtod(tests[i].str, NULL);
+        memcpy(&bits, &d, sizeof(bits));
+        ok(bits == tests[i].bits || broken(1) /* older msvcrt */,
+                "%s: got %#I64x, expected %#I64x\n", tests[i].str, bits, tests[i].bits);
+    }
+
+    /* short inputs with small exponents are converted without bignums, padding
+     * the mantissa with zeros forces the bignum path for the same value */
+    for (i = 0; i < 20000; i++)
+    {
+        digits = strtod_rand() % 19 + 1;
+        m = (strtod_rand() << 40) ^ (strtod_rand() << 20) ^ strtod_rand();
+        for (j = 0, k = 1; j < digits; j++) k *= 10;
+        if (!(m %= k)) m = 1;
+        e = strtod_rand() % 55 - 27;
+
+        sprintf(str, "%I64ue%d", m, e);
+        sprintf(long_str, "%I64u%se%d", m, zeros, e - (int)strlen(zeros));
+        d = strtod(str, NULL);
+        memcpy(&bits, &d, sizeof(bits));
+        d = strtod(long_str, NULL);
+        memcpy(&long_bits, &d, sizeof(long_bits));
+        ok(bits == long_bits || broken(1) /* older msvcrt */,
+                "%s: got %#I64x, expected %#I64x\n", str, bits, long_bits);
+    }
+
+    /* exact halfway cases between two doubles round to even */
+    for (i = 0; i < 2000; i++)
+    {
+        k = ((strtod_rand() << 32) ^ (strtod_rand() << 16) ^ strtod_rand()) & (((ULONGLONG)1 << 52) - 1);
+        k |= (ULONGLONG)1 << 52;
+        expect = (double)(k + (k & 1));
+        if (i & 1)
+        {
+            /* (2k+1) * 2^j */
+            j = strtod_rand() % 10;
+            sprintf(str, "%I64u", (2 * k + 1) << j);
+            expect = ldexp(expect, j + 1);
+        }
+        else
+        {
+            /* (2k+1) * 5^j * 10^-j */
+            j = strtod_rand() % 3 + 1;
+            for (e = 0, m = 2 * k + 1; e < j; e++) m *= 5;
+            sprintf(str, "%I64ue-%d", m, j);
+            expect = ldexp(expect, 1 - j);
+        }
+        d = strtod(str, NULL);
+        ok(d == expect || broken(1) /* older msvcrt */, "%s: got %.17e, expected %.17e\n", str, d, expect);
+    }
+}
+
 static void test_mbstowcs(void)
 {
     static const wchar_t wSimple[] = L"text";
@@ -4645,6 +4741,66 @@ static void test_wcscmp(void)
     ok(!r, "wcscmp returned %d\n", r);
 }
 
+static void test_str_alignment(void)
+{
+    char buf[64], buf2[64];
+    wchar_t wbuf[64], wbuf2[64];
+    int i, len, r;
+
+    for (i = 0; i < 16; i++)
+    {
+        for (len = 0; len < 40; len++)
+        {
+            char *str = buf + i;
+            wchar_t *wstr = wbuf + i;
+
+            memset(buf, 0x80, sizeof(buf));
+            memset(str, 'a', len);
+            str[len] = 0;
+            ok(strlen(str) == len, "%d/%d: strlen returned %Iu\n", i, len, strlen(str));
+            ok(strchr(str, 0) == str + len, "%d/%d: strchr returned %p\n", i, len, strchr(str, 0));
+            ok(!strchr(str, 'b'), "%d/%d: strchr returned %p\n", i, len, strchr(str, 'b'));
+            ok(memchr(str, 0x80, sizeof(buf) - i) == (len < sizeof(buf) - i - 1 ? str + len + 1 : NULL),
+               "%d/%d: memchr returned %p\n", i, len, memchr(str, 0x80, sizeof(buf) - i));
+            if (len)
+            {
+                str[len - 1] = 'b';
+                ok(strchr(str, 'b') == str + len - 1, "%d/%d: strchr returned %p\n", i, len, strchr(str, 'b'));
+                ok(memchr(str, 'b', len) == str + len - 1, "%d/%d: memchr returned %p\n", i, len, memchr(str, 'b', len));
+                ok(!memchr(str, 'b', len - 1), "%d/%d: memchr returned %p\n", i, len, memchr(str, 'b', len - 1));
+
+                memcpy(buf2 + i, str, len + 1);
+                r = p_strcmp(str, buf2 + i);
+                ok(!r, "%d/%d: strcmp returned %d\n", i, len, r);
+                buf2[i + len - 1] = '\xb0';
+                r = p_strcmp(str, buf2 + i);
+                ok(r == -1, "%d/%d: strcmp returned %d\n", i, len, r);
+                r = p_strcmp(buf2 + i, str);
+                ok(r == 1, "%d/%d: strcmp returned %d\n", i, len, r);
+            }
+
+            memset(wbuf, 0x80, sizeof(wbuf));
+            wmemset(wstr, 'a', len);
+            wstr[len] = 0;
+            ok(wcslen(wstr) == len, "%d/%d: wcslen returned %Iu\n", i, len, wcslen(wstr));
+            ok(wcschr(wstr, 0) == wstr + len, "%d/%d: wcschr returned %p\n", i, len, wcschr(wstr, 0));
+            ok(!wcschr(wstr, 0x8080), "%d/%d: wcschr returned %p\n", i, len, wcschr(wstr, 0x8080));
+            if (len)
+            {
+                wstr[len - 1] = 0x8000;
+                ok(wcschr(wstr, 0x8000) == wstr + len - 1, "%d/%d: wcschr returned %p\n", i, len, wcschr(wstr, 0x8000));
+
+                memcpy(wbuf2 + i, wstr, (len + 1) * sizeof(wchar_t));
+                r = wcscmp(wstr, wbuf2 + i);
+                ok(!r, "%d/%d: wcscmp returned %d\n", i, len, r);
+                wbuf2[i + len - 1] = 0x8001;
+                r = wcscmp(wstr, wbuf2 + i);
+                ok(r == -1, "%d/%d: wcscmp returned %d\n", i, len, r);
+            }
+        }
+    }
+}
+
 static const char* debugstr_ldouble(_LDOUBLE *v)
 {
     static char buf[2 * ARRAY_SIZE(v->ld) + 1];
@@ -5142,6 +5298,7 @@ START_TEST(string)
     test_strnlen();
     test__strtoi64();
     test__strtod();
+    test_strtod_exact();
     test_mbstowcs();
     test__wcstombs_s_l();
     test_gcvt();
@@ -5181,6 +5338,7 @@ START_TEST(string)
     test_strstr();
     test_iswdigit();
     test_wcscmp();
+    test_str_alignment();
     test___STRINGTOLD();
     test_SpecialCasing();
     test__mbbtype();
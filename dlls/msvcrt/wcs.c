@@ -1962,11 +1962,31 @@ int WINAPIV _swprintf_p_l(wchar_t *buffer, size_t length,
     return r;
 }
 
+#define WCHAR_ONES (~(size_t)0 / 0xffff)
+
+/* Returns non-zero if any wchar_t in v is zero. Callers only use it on aligned
+ * words so that reading past the terminator never crosses a page boundary. */
+static inline size_t has_zero_wchar(size_t v)
+{
+    return (v - WCHAR_ONES) & ~v & (WCHAR_ONES << 15);
+}
+
 /*********************************************************************
  *              wcscmp (MSVCRT.@)
  */
 int CDECL wcscmp(const wchar_t *str1, const wchar_t *str2)
 {
+    /* compare word by word when both strings can be aligned together */
+    if (!(((ULONG_PTR)str1 ^ (ULONG_PTR)str2) & (sizeof(size_t) - 1)) && !((ULONG_PTR)str1 & 1))
+    {
+        const size_t *w1, *w2;
+
+        while (((ULONG_PTR)str1 & (sizeof(size_t) - 1)) && *str1 && *str1 == *str2) { str1++; str2++; }
+        for (w1 = (const size_t *)str1, w2 = (const size_t *)str2;
+             !((ULONG_PTR)w1 & (sizeof(size_t) - 1)) && *w1 == *w2 && !has_zero_wchar(*w1); w1++, w2++);
+        str1 = (const wchar_t *)w1;
+        str2 = (const wchar_t *)w2;
+    }
     while (*str1 && (*str1 == *str2))
     {
         str1++;
@@ -2950,6 +2970,19 @@ wint_t CDECL towupper(wint_t c)
  */
 wchar_t* CDECL wcschr(const wchar_t *str, wchar_t ch)
 {
+    size_t mask = WCHAR_ONES * ch;
+    const size_t *w;
+
+    if (!((ULONG_PTR)str & 1))
+    {
+        for (; (ULONG_PTR)str & (sizeof(size_t) - 1); str++)
+        {
+            if (*str == ch) return (WCHAR *)(ULONG_PTR)str;
+            if (!*str) return NULL;
+        }
+        for (w = (const size_t *)str; !has_zero_wchar(*w) && !has_zero_wchar(*w ^ mask); w++);
+        str = (const wchar_t *)w;
+    }
     do { if (*str == ch) return (WCHAR *)(ULONG_PTR)str; } while (*str++);
     return NULL;
 }
@@ -2970,6 +3003,14 @@ wchar_t* CDECL wcsrchr(const wchar_t *str, wchar_t ch)
 size_t CDECL wcslen(const wchar_t *str)
 {
     const wchar_t *s = str;
+    const size_t *w;
+
+    if (!((ULONG_PTR)s & 1))
+    {
+        for (; (ULONG_PTR)s & (sizeof(size_t) - 1); s++) if (!*s) return s - str;
+        for (w = (const size_t *)s; !has_zero_wchar(*w); w++);
+        s = (const wchar_t *)w;
+    }
     while (*s) s++;
     return s - str;
 }
@@ -1129,9 +1129,12 @@ void * WINAPI RtlFindExportedRoutineByName( HMODULE module, const char *name )
  *		import_dll
  *
  * Import the dll specified by the given import descriptor.
+ * If the thunks are located inside the [iat, iat + iat_size) range, the
+ * caller has already made them writable.
  * The loader_section must be locked while calling this function.
  */
-static BOOL import_dll( WINE_MODREF *wm, const IMAGE_IMPORT_DESCRIPTOR *descr, LPCWSTR load_path, WINE_MODREF **pwm )
+static BOOL import_dll( WINE_MODREF *wm, const IMAGE_IMPORT_DESCRIPTOR *descr, LPCWSTR load_path,
+                        const char *iat, SIZE_T iat_size, WINE_MODREF **pwm )
 {
     HMODULE module = wm->ldr.DllBase;
     BOOL system = wm->system || (wm->ldr.Flags & LDR_WINE_INTERNAL);
@@ -1179,10 +1182,15 @@ static BOOL import_dll( WINE_MODREF *wm, const IMAGE_IMPORT_DESCRIPTOR *descr, L
     /* unprotect the import address table since it can be located in
      * readonly section */
     while (import_list[protect_size].u1.Ordinal) protect_size++;
-    protect_base = thunk_list;
     protect_size *= sizeof(*thunk_list);
-    NtProtectVirtualMemory( NtCurrentProcess(), &protect_base,
-                            &protect_size, PAGE_READWRITE, &protect_old );
+    if ((const char *)thunk_list >= iat && (const char *)thunk_list + protect_size <= iat + iat_size)
+        protect_size = 0;  /* already writable */
+    else
+    {
+        protect_base = thunk_list;
+        NtProtectVirtualMemory( NtCurrentProcess(), &protect_base,
+                                &protect_size, PAGE_READWRITE, &protect_old );
+    }
 
     imp_mod = wmImp->ldr.DllBase;
     exports = RtlImageDirectoryEntryToData( imp_mod, TRUE, IMAGE_DIRECTORY_ENTRY_EXPORT, &exp_size );
@@ -1253,7 +1261,8 @@ static BOOL import_dll( WINE_MODREF *wm, const IMAGE_IMPORT_DESCRIPTOR *descr, L
 
 done:
     /* restore old protection of the import address table */
-    NtProtectVirtualMemory( NtCurrentProcess(), &protect_base, &protect_size, protect_old, &protect_old );
+    if (protect_size)
+        NtProtectVirtualMemory( NtCurrentProcess(), &protect_base, &protect_size, protect_old, &protect_old );
     *pwm = wmImp;
     return TRUE;
 }
@@ -1477,9 +1486,13 @@ static NTSTATUS fixup_imports( WINE_MODREF *wm, LPCWSTR load_path )
     SINGLE_LIST_ENTRY *dep_after;
     WINE_MODREF *imp;
     int i, nb_imports;
-    DWORD size;
+    DWORD size, iat_size = 0;
     NTSTATUS status;
     ULONG_PTR cookie;
+    char *iat;
+    void *protect_base;
+    SIZE_T protect_size;
+    DWORD protect_old;
 
     if (!(wm->ldr.Flags & LDR_DONT_RESOLVE_REFS)) return STATUS_SUCCESS;  /* already done */
     wm->ldr.Flags &= ~LDR_DONT_RESOLVE_REFS;
@@ -1498,6 +1511,19 @@ static NTSTATUS fixup_imports( WINE_MODREF *wm, LPCWSTR load_path )
     if (!create_module_activation_context( &wm->ldr ))
         RtlActivateActivationContext( 0, wm->ldr.ActivationContext, &cookie );
 
+    /* unprotect the whole import address table at once, instead of
+     * once for every imported dll */
+    if ((iat = RtlImageDirectoryEntryToData( wm->ldr.DllBase, TRUE, IMAGE_DIRECTORY_ENTRY_IAT, &iat_size )) &&
+        iat_size)
+    {
+        protect_base = iat;
+        protect_size = iat_size;
+        if (NtProtectVirtualMemory( NtCurrentProcess(), &protect_base, &protect_size,
+                                    PAGE_READWRITE, &protect_old ))
+            iat = NULL;
+    }
+    else iat = NULL;
+
     /* load the imported modules. They are automatically
      * added to the modref list of the process.
      */
@@ -1505,11 +1531,14 @@ static NTSTATUS fixup_imports( WINE_MODREF *wm, LPCWSTR load_path )
     for (i = 0; i < nb_imports; i++)
     {
         dep_after = wm->ldr.DdagNode->Dependencies.Tail;
-        if (!import_dll( wm, &imports[i], load_path, &imp ))
+        if (!import_dll( wm, &imports[i], load_path, iat, iat ? iat_size : 0, &imp ))
             status = STATUS_DLL_NOT_FOUND;
         else if (imp && imp->ldr.DdagNode != node_ntdll && imp->ldr.DdagNode != node_kernel32)
             add_module_dependency_after( wm->ldr.DdagNode, imp->ldr.DdagNode, dep_after );
     }
+
+    if (iat) NtProtectVirtualMemory( NtCurrentProcess(), &protect_base, &protect_size,
+                                     protect_old, &protect_old );
     if (wm->ldr.ActivationContext) RtlDeactivateActivationContext( 0, cookie );
     return status;
 }
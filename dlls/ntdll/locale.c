@@ -414,8 +414,11 @@ LONG WINAPI RtlCompareUnicodeStrings( const WCHAR *s1, SIZE_T len1, const WCHAR
     {
         if (nls_info.UpperCaseTable)
         {
-            while (!ret && len--) ret = casemap( nls_info.UpperCaseTable, *s1++ ) -
-                                        casemap( nls_info.UpperCaseTable, *s2++ );
+            for (; !ret && len; len--, s1++, s2++)
+            {
+                if (*s1 == *s2) continue;  /* no need to map identical chars */
+                ret = casemap( nls_info.UpperCaseTable, *s1 ) - casemap( nls_info.UpperCaseTable, *s2 );
+            }
         }
         else  /* locale not setup yet */
         {
@@ -443,7 +446,8 @@ BOOLEAN WINAPI RtlPrefixUnicodeString( const UNICODE_STRING *s1, const UNICODE_S
     if (ignore_case)
     {
         for (i = 0; i < s1->Length / sizeof(WCHAR); i++)
-            if (casemap( nls_info.UpperCaseTable, s1->Buffer[i] ) !=
+            if (s1->Buffer[i] != s2->Buffer[i] &&
+                casemap( nls_info.UpperCaseTable, s1->Buffer[i] ) !=
                 casemap( nls_info.UpperCaseTable, s2->Buffer[i] )) return FALSE;
     }
     else
@@ -1061,7 +1065,7 @@ NTSTATUS WINAPI RtlIsNormalizedString( ULONG form, const WCHAR *str, INT len, BO
  */
 NTSTATUS WINAPI RtlNormalizeString( ULONG form, const WCHAR *src, INT src_len, WCHAR *dst, INT *dst_len )
 {
-    int buf_len;
+    int i, buf_len;
     WCHAR *buf = NULL;
     const struct norm_table *info;
     NTSTATUS status = STATUS_SUCCESS;
@@ -1084,6 +1088,19 @@ NTSTATUS WINAPI RtlNormalizeString( ULONG form, const WCHAR *src, INT src_len, W
         return STATUS_SUCCESS;
     }
 
+    /* ASCII strings are already normalized in all the standard forms */
+    if (form == NormalizationC || form == NormalizationD ||
+        form == NormalizationKC || form == NormalizationKD)
+    {
+        for (i = 0; i < src_len; i++) if (src[i] >= 0x80) break;
+        if (i == src_len && *dst_len >= src_len)
+        {
+            memcpy( dst, src, src_len * sizeof(WCHAR) );
+            *dst_len = src_len;
+            return STATUS_SUCCESS;
+        }
+    }
+
     if (!info->comp_size) return decompose_string( info, src, src_len, dst, dst_len );
 
     buf_len = src_len * 4;
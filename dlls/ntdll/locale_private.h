@@ -316,6 +316,15 @@ static inline NTSTATUS utf8_wcstombs_size( const WCHAR *src, unsigned int srclen
 
     for (len = 0; srclen; srclen--, src++)
     {
+        /* count ASCII characters four at a time */
+        while (srclen >= 4 && (src[0] | src[1] | src[2] | src[3]) < 0x80)
+        {
+            src += 4;
+            srclen -= 4;
+            len += 4;
+        }
+        if (!srclen) break;
+
         if (*src < 0x80) len++;  /* 0x00-0x7f: 1 byte */
         else if (*src < 0x800) len += 2;  /* 0x80-0x7ff: 2 bytes */
         else
@@ -347,7 +356,17 @@ static inline NTSTATUS utf8_mbstowcs_size( const char *src, unsigned int srclen,
 
     for (len = 0; src < srcend; len++)
     {
-        unsigned char ch = *src++;
+        unsigned char ch;
+
+        /* count ASCII characters four at a time */
+        while (srcend - src >= 4 && !((src[0] | src[1] | src[2] | src[3]) & 0x80))
+        {
+            src += 4;
+            len += 4;
+        }
+        if (src == srcend) break;
+
+        ch = *src++;
         if (ch < 0x80) continue;
         if ((res = decode_utf8_char( ch, &src, srcend )) > 0x10ffff)
             status = STATUS_SOME_NOT_MAPPED;
@@ -429,7 +448,21 @@ static inline NTSTATUS utf8_mbstowcs( WCHAR *dst, unsigned int dstlen, unsigned
 
     while ((dst < dstend) && (src < srcend))
     {
-        unsigned char ch = *src++;
+        unsigned char ch;
+
+        /* convert ASCII characters four at a time */
+        while (srcend - src >= 4 && dstend - dst >= 4 && !((src[0] | src[1] | src[2] | src[3]) & 0x80))
+        {
+            dst[0] = src[0];
+            dst[1] = src[1];
+            dst[2] = src[2];
+            dst[3] = src[3];
+            src += 4;
+            dst += 4;
+        }
+        if (dst == dstend || src == srcend) break;
+
+        ch = *src++;
         if (ch < 0x80)  /* special fast case for 7-bit ASCII */
         {
             *dst++ = ch;
@@ -471,8 +504,22 @@ static inline NTSTATUS utf8_wcstombs( char *dst, unsigned int dstlen, unsigned i
 
     for (end = dst + dstlen; srclen; srclen--, src++)
     {
-        WCHAR ch = *src;
+        WCHAR ch;
+
+        /* convert ASCII characters four at a time */
+        while (srclen >= 4 && end - dst >= 4 && (src[0] | src[1] | src[2] | src[3]) < 0x80)
+        {
+            dst[0] = src[0];
+            dst[1] = src[1];
+            dst[2] = src[2];
+            dst[3] = src[3];
+            src += 4;
+            dst += 4;
+            srclen -= 4;
+        }
+        if (!srclen) break;
 
+        ch = *src;
         if (ch < 0x80)  /* 0x00-0x7f: 1 byte */
         {
             if (dst > end - 1) break;
@@ -2860,6 +2860,122 @@ static void test_query_directory(void)
     pNtClose( dir );
 }
 
+static int get_event_index( const UNICODE_STRING *name )
+{
+    unsigned int i, ret = 0;
+
+    if (name->Length < 3 * sizeof(WCHAR) || wcsncmp( name->Buffer, L"ev", 2 )) return -1;
+    for (i = 2; i < name->Length / sizeof(WCHAR); i++)
+    {
+        if (name->Buffer[i] < '0' || name->Buffer[i] > '9') return -1;
+        ret = ret * 10 + name->Buffer[i] - '0';
+    }
+    return ret;
+}
+
+static void test_query_directory_many(void)
+{
+    char buffer[200];
+    DIRECTORY_BASIC_INFORMATION *info = (void *)buffer;
+    unsigned int i, first_count = 20, count = 600;
+    HANDLE dir, events[600], handle;
+    unsigned char seen[600];
+    OBJECT_ATTRIBUTES attr;
+    UNICODE_STRING string;
+    ULONG context, size;
+    NTSTATUS status;
+    WCHAR name[16];
+    int index;
+
+    RtlInitUnicodeString( &string, L"\\BaseNamedObjects\\winetest_many" );
+    InitializeObjectAttributes( &attr, &string, 0, 0, NULL );
+    status = pNtCreateDirectoryObject( &dir, DIRECTORY_QUERY | DIRECTORY_CREATE_OBJECT, &attr );
+    ok( !status, "got %#lx\n", status );
+
+    InitializeObjectAttributes( &attr, &string, 0, dir, NULL );
+    for (i = 0; i < first_count; i++)
+    {
+        swprintf( name, ARRAY_SIZE(name), L"ev%u", i );
+        RtlInitUnicodeString( &string, name );
+        status = pNtCreateEvent( &events[i], EVENT_ALL_ACCESS, &attr, NotificationEvent, FALSE );
+        ok( !status, "%u: got %#lx\n", i, status );
+    }
+
+    /* add enough names in the middle of an enumeration to grow the directory */
+    memset( seen, 0, sizeof(seen) );
+    context = 0;
+    for (i = 0; i < first_count / 2; i++)
+    {
+        status = NtQueryDirectoryObject( dir, info, sizeof(buffer), TRUE, FALSE, &context, &size );
+        ok( !status, "%u: got %#lx\n", i, status );
+        index = get_event_index( &info[0].ObjectName );
+        ok( index >= 0 && index < first_count, "got %s\n", debugstr_w(info[0].ObjectName.Buffer) );
+        if (index >= 0 && index < count) seen[index]++;
+    }
+    for (i = first_count; i < count; i++)
+    {
+        swprintf( name, ARRAY_SIZE(name), L"ev%u", i );
+        RtlInitUnicodeString( &string, name );
+        status = pNtCreateEvent( &events[i], EVENT_ALL_ACCESS, &attr, NotificationEvent, FALSE );
+        ok( !status, "%u: got %#lx\n", i, status );
+    }
+    while (!(status = NtQueryDirectoryObject( dir, info, sizeof(buffer), TRUE, FALSE, &context, &size )))
+    {
+        index = get_event_index( &info[0].ObjectName );
+        ok( index >= 0 && index < count, "got %s\n", debugstr_w(info[0].ObjectName.Buffer) );
+        if (index >= 0 && index < count) seen[index]++;
+    }
+    ok( status == STATUS_NO_MORE_ENTRIES, "got %#lx\n", status );
+    /* names added during the enumeration may or may not be returned, but the others
+     * must be returned once; Windows may repeat some of them */
+    for (i = 0; i < first_count; i++)
+        ok( seen[i] == 1 || broken(seen[i] > 1), "%u: seen %u times\n", i, seen[i] );
+    for (i = first_count; i < count; i++)
+        ok( seen[i] <= 1, "%u: seen %u times\n", i, seen[i] );
+
+    /* enumerate everything again */
+    memset( seen, 0, sizeof(seen) );
+    context = 0;
+    while (!(status = NtQueryDirectoryObject( dir, info, sizeof(buffer), TRUE, FALSE, &context, &size )))
+    {
+        index = get_event_index( &info[0].ObjectName );
+        ok( index >= 0 && index < count, "got %s\n", debugstr_w(info[0].ObjectName.Buffer) );
+        if (index >= 0 && index < count) seen[index]++;
+    }
+    ok( status == STATUS_NO_MORE_ENTRIES, "got %#lx\n", status );
+    ok( context == count, "got context %lu\n", context );
+    for (i = 0; i < count; i++)
+        ok( seen[i] == 1, "%u: seen %u times\n", i, seen[i] );
+
+    /* lookups still find every name */
+    for (i = 0; i < count; i++)
+    {
+        swprintf( name, ARRAY_SIZE(name), L"ev%u", i );
+        RtlInitUnicodeString( &string, name );
+        status = pNtOpenEvent( &handle, EVENT_ALL_ACCESS, &attr );
+        ok( !status, "%u: got %#lx\n", i, status );
+        if (!status) pNtClose( handle );
+    }
+    RtlInitUnicodeString( &string, L"ev600" );
+    status = pNtOpenEvent( &handle, EVENT_ALL_ACCESS, &attr );
+    ok( status == STATUS_OBJECT_NAME_NOT_FOUND, "got %#lx\n", status );
+
+    for (i = 0; i < count; i++) pNtClose( events[i] );
+
+    for (i = 0; i < count; i += 97)
+    {
+        swprintf( name, ARRAY_SIZE(name), L"ev%u", i );
+        RtlInitUnicodeString( &string, name );
+        status = pNtOpenEvent( &handle, EVENT_ALL_ACCESS, &attr );
+        ok( status == STATUS_OBJECT_NAME_NOT_FOUND, "%u: got %#lx\n", i, status );
+    }
+    context = 0;
+    status = NtQueryDirectoryObject( dir, info, sizeof(buffer), TRUE, TRUE, &context, &size );
+    ok( status == STATUS_NO_MORE_ENTRIES, "got %#lx\n", status );
+
+    pNtClose( dir );
+}
+
 #define test_object_name_with_null(a,b) _test_object_name_with_null(__LINE__,a,b)
 static void _test_object_name_with_null(unsigned line, HANDLE handle, UNICODE_STRING *expect)
 {
@@ -3947,6 +4063,7 @@ START_TEST(om)
     test_globalroot();
     test_object_identity();
     test_query_directory();
+    test_query_directory_many();
     test_object_permanence();
     test_zero_access();
     test_NtAllocateReserveObject();
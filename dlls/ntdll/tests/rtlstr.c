@@ -2638,6 +2638,172 @@ static void test_RtlUTF8ToUnicodeN(void)
     }
 }
 
+static void test_utf8_ascii_blocks(void)
+{
+    static const struct
+    {
+        const char *utf8;
+        WCHAR unicode[2];
+    } chars[] =
+    {
+        { "\xC3\xA9", { 0x00e9 } },
+        { "\xE2\x82\xAC", { 0x20ac } },
+        { "\xF0\x9F\x98\x80", { 0xd83d, 0xde00 } },
+    };
+    static const char ascii[] = "abcdefghijklmnopqrstuvwxyz";
+    char utf8[32], truncA[32], bufferA[64];
+    WCHAR unicode[32], truncW[32], bufferW[64];
+    unsigned int i, j, pos, len, tail, lenA, lenW, charA, charW, expect;
+    NTSTATUS status;
+    ULONG bytes_out;
+    int ret;
+
+    if (!pRtlUTF8ToUnicodeN || !pRtlUnicodeToUTF8N)
+    {
+        win_skip("RtlUTF8ToUnicodeN or RtlUnicodeToUTF8N is not available\n");
+        return;
+    }
+
+    /* ASCII is converted four characters at a time, put the multibyte
+     * character at every offset of the first three blocks */
+    for (i = 0; i < ARRAY_SIZE(chars); i++)
+    {
+        charA = strlen(chars[i].utf8);
+        charW = chars[i].unicode[1] ? 2 : 1;
+        for (pos = 0; pos < 12; pos++)
+        {
+            winetest_push_context("char %u pos %u", i, pos);
+
+            memcpy(utf8, ascii, pos);
+            memcpy(utf8 + pos, chars[i].utf8, charA);
+            memcpy(utf8 + pos + charA, ascii + pos, 9);
+            lenA = pos + charA + 9;
+            for (j = 0; j < pos; j++) unicode[j] = ascii[j];
+            memcpy(unicode + pos, chars[i].unicode, charW * sizeof(WCHAR));
+            for (j = 0; j < 9; j++) unicode[pos + charW + j] = ascii[pos + j];
+            lenW = pos + charW + 9;
+
+            bytes_out = 0xdeadbeef;
+            status = pRtlUTF8ToUnicodeN(NULL, 0, &bytes_out, utf8, lenA);
+            ok(status == STATUS_SUCCESS, "status = 0x%lx\n", status);
+            ok(bytes_out == lenW * sizeof(WCHAR), "bytes_out = %lu\n", bytes_out);
+
+            bytes_out = 0xdeadbeef;
+            memset(bufferW, 0x55, sizeof(bufferW));
+            status = pRtlUTF8ToUnicodeN(bufferW, sizeof(bufferW), &bytes_out, utf8, lenA);
+            ok(status == STATUS_SUCCESS, "status = 0x%lx\n", status);
+            ok(bytes_out == lenW * sizeof(WCHAR), "bytes_out = %lu\n", bytes_out);
+            ok(!memcmp(bufferW, unicode, lenW * sizeof(WCHAR)), "got %s\n", wine_dbgstr_wn(bufferW, lenW));
+            ok(bufferW[lenW] == 0x5555, "behind string: 0x%x\n", bufferW[lenW]);
+
+            memset(bufferW, 0x55, sizeof(bufferW));
+            ret = MultiByteToWideChar(CP_UTF8, 0, utf8, lenA, bufferW, ARRAY_SIZE(bufferW));
+            ok(ret == lenW, "wrong len %d\n", ret);
+            ok(!memcmp(bufferW, unicode, lenW * sizeof(WCHAR)), "got %s\n", wine_dbgstr_wn(bufferW, lenW));
+            ok(bufferW[lenW] == 0x5555, "behind string: 0x%x\n", bufferW[lenW]);
+
+            bytes_out = 0xdeadbeef;
+            status = pRtlUnicodeToUTF8N(NULL, 0, &bytes_out, unicode, lenW * sizeof(WCHAR));
+            ok(status == STATUS_SUCCESS, "status = 0x%lx\n", status);
+            ok(bytes_out == lenA, "bytes_out = %lu\n", bytes_out);
+
+            bytes_out = 0xdeadbeef;
+            memset(bufferA, 0x55, sizeof(bufferA));
+            status = pRtlUnicodeToUTF8N(bufferA, sizeof(bufferA), &bytes_out, unicode, lenW * sizeof(WCHAR));
+            ok(status == STATUS_SUCCESS, "status = 0x%lx\n", status);
+            ok(bytes_out == lenA, "bytes_out = %lu\n", bytes_out);
+            ok(!memcmp(bufferA, utf8, lenA), "got %s\n", wine_dbgstr_an(bufferA, lenA));
+            ok(bufferA[lenA] == 0x55, "behind string: 0x%x\n", bufferA[lenA]);
+
+            memset(bufferA, 0x55, sizeof(bufferA));
+            ret = WideCharToMultiByte(CP_UTF8, 0, unicode, lenW, bufferA, sizeof(bufferA), NULL, NULL);
+            ok(ret == lenA, "wrong len %d\n", ret);
+            ok(!memcmp(bufferA, utf8, lenA), "got %s\n", wine_dbgstr_an(bufferA, lenA));
+            ok(bufferA[lenA] == 0x55, "behind string: 0x%x\n", bufferA[lenA]);
+
+            /* output buffer ending inside or right after an ASCII block */
+            for (len = 0; len < lenW; len++)
+            {
+                bytes_out = 0xdeadbeef;
+                memset(bufferW, 0x55, sizeof(bufferW));
+                status = pRtlUTF8ToUnicodeN(bufferW, len * sizeof(WCHAR), &bytes_out, utf8, lenA);
+                ok(status == STATUS_BUFFER_TOO_SMALL, "%u: status = 0x%lx\n", len, status);
+                ok(bytes_out == len * sizeof(WCHAR), "%u: bytes_out = %lu\n", len, bytes_out);
+                ok(!memcmp(bufferW, unicode, len * sizeof(WCHAR)), "%u: got %s\n", len, wine_dbgstr_wn(bufferW, len));
+                ok(bufferW[len] == 0x5555, "%u: behind string: 0x%x\n", len, bufferW[len]);
+            }
+            for (len = 0; len < lenA; len++)
+            {
+                /* partial characters are not written */
+                expect = (len > pos && len < pos + charA) ? pos : len;
+                bytes_out = 0xdeadbeef;
+                memset(bufferA, 0x55, sizeof(bufferA));
+                status = pRtlUnicodeToUTF8N(bufferA, len, &bytes_out, unicode, lenW * sizeof(WCHAR));
+                ok(status == STATUS_BUFFER_TOO_SMALL, "%u: status = 0x%lx\n", len, status);
+                ok(bytes_out == expect, "%u: bytes_out = %lu\n", len, bytes_out);
+                ok(!memcmp(bufferA, utf8, expect), "%u: got %s\n", len, wine_dbgstr_an(bufferA, expect));
+                ok(bufferA[expect] == 0x55, "%u: behind string: 0x%x\n", len, bufferA[expect]);
+            }
+
+            /* truncated sequences, at the end of the input and followed by ASCII */
+            for (j = 0; j < pos; j++) truncW[j] = ascii[j];
+            truncW[pos] = 0xfffd;
+            for (j = 0; j < 9; j++) truncW[pos + 1 + j] = ascii[pos + j];
+            for (len = 1; len < charA; len++)
+            {
+                memcpy(truncA, utf8, pos + len);
+                memcpy(truncA + pos + len, ascii + pos, 9);
+                for (tail = 0; tail <= 9; tail += 9)
+                {
+                    bytes_out = 0xdeadbeef;
+                    status = pRtlUTF8ToUnicodeN(NULL, 0, &bytes_out, truncA, pos + len + tail);
+                    ok(status == STATUS_SOME_NOT_MAPPED, "%u/%u: status = 0x%lx\n", len, tail, status);
+                    ok(bytes_out == (pos + 1 + tail) * sizeof(WCHAR), "%u/%u: bytes_out = %lu\n", len, tail, bytes_out);
+
+                    bytes_out = 0xdeadbeef;
+                    memset(bufferW, 0x55, sizeof(bufferW));
+                    status = pRtlUTF8ToUnicodeN(bufferW, sizeof(bufferW), &bytes_out, truncA, pos + len + tail);
+                    ok(status == STATUS_SOME_NOT_MAPPED, "%u/%u: status = 0x%lx\n", len, tail, status);
+                    ok(bytes_out == (pos + 1 + tail) * sizeof(WCHAR), "%u/%u: bytes_out = %lu\n", len, tail, bytes_out);
+                    ok(!memcmp(bufferW, truncW, (pos + 1 + tail) * sizeof(WCHAR)),
+                       "%u/%u: got %s\n", len, tail, wine_dbgstr_wn(bufferW, pos + 1 + tail));
+                    ok(bufferW[pos + 1 + tail] == 0x5555,
+                       "%u/%u: behind string: 0x%x\n", len, tail, bufferW[pos + 1 + tail]);
+                }
+            }
+
+            /* unpaired high surrogate, at the end of the input and followed by ASCII */
+            if (charW == 2)
+            {
+                memcpy(truncW, unicode, (pos + 1) * sizeof(WCHAR));
+                for (j = 0; j < 9; j++) truncW[pos + 1 + j] = ascii[pos + j];
+                memcpy(truncA, utf8, pos);
+                memcpy(truncA + pos, "\xEF\xBF\xBD", 3);
+                memcpy(truncA + pos + 3, ascii + pos, 9);
+                for (tail = 0; tail <= 9; tail += 9)
+                {
+                    bytes_out = 0xdeadbeef;
+                    status = pRtlUnicodeToUTF8N(NULL, 0, &bytes_out, truncW, (pos + 1 + tail) * sizeof(WCHAR));
+                    ok(status == STATUS_SOME_NOT_MAPPED, "%u: status = 0x%lx\n", tail, status);
+                    ok(bytes_out == pos + 3 + tail, "%u: bytes_out = %lu\n", tail, bytes_out);
+
+                    bytes_out = 0xdeadbeef;
+                    memset(bufferA, 0x55, sizeof(bufferA));
+                    status = pRtlUnicodeToUTF8N(bufferA, sizeof(bufferA), &bytes_out,
+                                                truncW, (pos + 1 + tail) * sizeof(WCHAR));
+                    ok(status == STATUS_SOME_NOT_MAPPED, "%u: status = 0x%lx\n", tail, status);
+                    ok(bytes_out == pos + 3 + tail, "%u: bytes_out = %lu\n", tail, bytes_out);
+                    ok(!memcmp(bufferA, truncA, pos + 3 + tail), "%u: got %s\n",
+                       tail, wine_dbgstr_an(bufferA, pos + 3 + tail));
+                    ok(bufferA[pos + 3 + tail] == 0x55, "%u: behind string: 0x%x\n", tail, bufferA[pos + 3 + tail]);
+                }
+            }
+
+            winetest_pop_context();
+        }
+    }
+}
+
 static NTSTATUS WINAPIV fmt( const WCHAR *src, ULONG width, BOOLEAN ignore_inserts, BOOLEAN ansi,
                              WCHAR *buffer, ULONG size, ULONG *retsize, ... )
 {
@@ -2971,5 +3137,6 @@ START_TEST(rtlstr)
     test_RtlHashUnicodeString();
     test_RtlUnicodeToUTF8N();
     test_RtlUTF8ToUnicodeN();
+    test_utf8_ascii_blocks();
     test_RtlFormatMessage();
 }
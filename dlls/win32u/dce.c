@@ -419,6 +419,7 @@ static BOOL set_surface_shape( struct window_surface *surface, const RECT *rect,
     void *shape_bits, *old_shape;
     RECT *shape_rect, tmp_rect;
     WINEREGION *data;
+    UINT dirty_offset, dirty_size;
     BOOL ret;
 
     width = color_info->bmiHeader.biWidth;
@@ -428,12 +429,15 @@ static BOOL set_surface_shape( struct window_surface *surface, const RECT *rect,
     if (!surface->shape_bitmap) surface->shape_bitmap = NtGdiCreateBitmap( width, height, 1, 1, NULL );
     if (!(shape_bits = window_surface_get_shape( surface, shape_info ))) return FALSE;
 
-    old_shape = malloc( shape_info->bmiHeader.biSizeImage );
-    memcpy( old_shape, shape_bits, shape_info->bmiHeader.biSizeImage );
-
     color_stride = color_info->bmiHeader.biSizeImage / height;
     shape_stride = shape_info->bmiHeader.biSizeImage / abs( shape_info->bmiHeader.biHeight );
 
+    /* only the dirty rows of the shape can change, no need to save and compare the others */
+    dirty_offset = dirty->top * shape_stride;
+    dirty_size = (dirty->bottom - dirty->top) * shape_stride;
+    old_shape = malloc( dirty_size );
+    memcpy( old_shape, (BYTE *)shape_bits + dirty_offset, dirty_size );
+
     if (!surface->shape_region) set_surface_shape_rect( shape_bits, shape_stride, dirty );
     else if ((data = GDI_GetObjPtr( surface->shape_region, NTGDI_OBJ_REGION )))
     {
@@ -499,7 +503,7 @@ static BOOL set_surface_shape( struct window_surface *surface, const RECT *rect,
     }
     }
 
-    ret = memcmp( old_shape, shape_bits, shape_info->bmiHeader.biSizeImage );
+    ret = memcmp( old_shape, (BYTE *)shape_bits + dirty_offset, dirty_size );
     free( old_shape );
     return ret;
 }
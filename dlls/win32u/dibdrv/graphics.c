@@ -753,18 +753,28 @@ static struct cached_glyph *cache_glyph_bitmap( DC *dc, struct cached_font *font
     int pad = 0, stride, bit_count;
     GLYPHMETRICS metrics;
     struct cached_glyph *glyph;
+    BYTE buffer[2048];
+    BOOL rendered;
 
     if (flags & ETO_GLYPH_INDEX) ggo_flags |= GGO_GLYPH_INDEX;
-    indices[0] = index;
-    for (i = 0; i < ARRAY_SIZE( indices ); i++)
+
+    /* most glyphs are small enough to be rendered right away, which
+     * saves loading them a second time after querying the size */
+    ret = NtGdiGetGlyphOutline( dc->hSelf, index, ggo_flags, &metrics, sizeof(buffer), buffer,
+                                &identity, FALSE );
+    if (!(rendered = (ret != GDI_ERROR)))
     {
-        index = indices[i];
-        ret = NtGdiGetGlyphOutline( dc->hSelf, index, ggo_flags, &metrics, 0, NULL,
-                                    &identity, FALSE );
-        if (ret != GDI_ERROR) break;
+        indices[0] = index;
+        for (i = 0; i < ARRAY_SIZE( indices ); i++)
+        {
+            index = indices[i];
+            ret = NtGdiGetGlyphOutline( dc->hSelf, index, ggo_flags, &metrics, 0, NULL,
+                                        &identity, FALSE );
+            if (ret != GDI_ERROR) break;
+        }
+        if (ret == GDI_ERROR) return NULL;
+        if (!ret) metrics.gmBlackBoxX = metrics.gmBlackBoxY = 0; /* empty glyph */
     }
-    if (ret == GDI_ERROR) return NULL;
-    if (!ret) metrics.gmBlackBoxX = metrics.gmBlackBoxY = 0; /* empty glyph */
 
     bit_count = get_glyph_depth( font->aa_flags );
     stride = get_dib_stride( metrics.gmBlackBoxX, bit_count );
@@ -775,14 +785,22 @@ static struct cached_glyph *cache_glyph_bitmap( DC *dc, struct cached_font *font
 
     if (bit_count == 8) pad = padding[ metrics.gmBlackBoxX % 4 ];
 
-    ret = NtGdiGetGlyphOutline( dc->hSelf, index, ggo_flags, &metrics, size, glyph->bits,
-                                &identity, FALSE );
-    if (ret == GDI_ERROR)
+    if (rendered)
     {
-        free( glyph );
-        return NULL;
+        assert( ret <= size );
+        memcpy( glyph->bits, buffer, ret );
+    }
+    else
+    {
+        ret = NtGdiGetGlyphOutline( dc->hSelf, index, ggo_flags, &metrics, size, glyph->bits,
+                                    &identity, FALSE );
+        if (ret == GDI_ERROR)
+        {
+            free( glyph );
+            return NULL;
+        }
+        assert( ret <= size );
     }
-    assert( ret <= size );
     if (font->aa_flags == GGO_BITMAP)
     {
         for (y = metrics.gmBlackBoxY - 1; y >= 0; y--)
@@ -4646,6 +4646,10 @@ static inline DWORD blend_argb( DWORD dst, DWORD src )
     BYTE g = (BYTE)(src >> 8);
     BYTE r = (BYTE)(src >> 16);
     DWORD alpha  = (BYTE)(src >> 24);
+
+    /* fast paths for fully opaque and fully transparent pixels, the result is the same */
+    if (alpha == 255) return src;
+    if (!src) return dst;
     return ((b     + ((BYTE)dst         * (255 - alpha) + 127) / 255) |
             (g     + ((BYTE)(dst >> 8)  * (255 - alpha) + 127) / 255) << 8 |
             (r     + ((BYTE)(dst >> 16) * (255 - alpha) + 127) / 255) << 16 |
@@ -4654,10 +4658,13 @@ static inline DWORD blend_argb( DWORD dst, DWORD src )
 
 static inline DWORD blend_argb_alpha( DWORD dst, DWORD src, DWORD alpha )
 {
-    BYTE b = ((BYTE)src         * alpha + 127) / 255;
-    BYTE g = ((BYTE)(src >> 8)  * alpha + 127) / 255;
-    BYTE r = ((BYTE)(src >> 16) * alpha + 127) / 255;
-    alpha  = ((BYTE)(src >> 24) * alpha + 127) / 255;
+    BYTE b, g, r;
+
+    if (!src) return dst;  /* fully transparent */
+    b = ((BYTE)src         * alpha + 127) / 255;
+    g = ((BYTE)(src >> 8)  * alpha + 127) / 255;
+    r = ((BYTE)(src >> 16) * alpha + 127) / 255;
+    alpha = ((BYTE)(src >> 24) * alpha + 127) / 255;
     return ((b     + ((BYTE)dst         * (255 - alpha) + 127) / 255) |
             (g     + ((BYTE)(dst >> 8)  * (255 - alpha) + 127) / 255) << 8 |
             (r     + ((BYTE)(dst >> 16) * (255 - alpha) + 127) / 255) << 16 |
@@ -4981,28 +4988,91 @@ static inline void triangle_weights( const TRIVERTEX *v, int x, int y, INT64 *l1
     *l2 = (v[2].y - v[0].y) * (x - v[2].x) - (v[2].x - v[0].x) * (y - v[2].y);
 }
 
-static inline DWORD gradient_triangle_8888( const TRIVERTEX *v, int x, int y, int det )
+/* incremental evaluation along a row of one colour channel, i.e. sum(color * weight) / det */
+struct triangle_channel
 {
-    INT64 l1, l2;
-    BYTE r, g, b, a;
+    INT64 quot, rem;    /* floor quotient and remainder of the current value */
+    INT64 dquot, drem;  /* floor quotient and remainder of the per-pixel increment */
+    INT64 det;
+};
+
+struct triangle_row
+{
+    struct triangle_channel r, g, b, a;
+};
+
+static inline void floor_divmod( INT64 num, INT64 den, INT64 *quot, INT64 *rem )
+{
+    *quot = num / den;
+    *rem = num % den;
+    if (*rem < 0)
+    {
+        *rem += den;
+        (*quot)--;
+    }
+}
+
+static inline void triangle_channel_init( struct triangle_channel *ch, const TRIVERTEX *v,
+                                          int c0, int c1, int c2, int x, int y, int det )
+{
+    INT64 l1, l2, val, step;
 
     triangle_weights( v, x, y, &l1, &l2 );
-    r = (v[0].Red   * l1 + v[1].Red   * l2 + v[2].Red   * (det - l1 - l2)) / det / 256;
-    g = (v[0].Green * l1 + v[1].Green * l2 + v[2].Green * (det - l1 - l2)) / det / 256;
-    b = (v[0].Blue  * l1 + v[1].Blue  * l2 + v[2].Blue  * (det - l1 - l2)) / det / 256;
-    a = (v[0].Alpha * l1 + v[1].Alpha * l2 + v[2].Alpha * (det - l1 - l2)) / det / 256;
+    val = c0 * l1 + c1 * l2 + c2 * (det - l1 - l2);
+    step = (INT64)(c0 - c2) * (v[1].y - v[2].y) + (INT64)(c1 - c2) * (v[2].y - v[0].y);
+    if (det < 0)
+    {
+        val = -val;
+        step = -step;
+        det = -det;
+    }
+    ch->det = det;
+    floor_divmod( val, det, &ch->quot, &ch->rem );
+    floor_divmod( step, det, &ch->dquot, &ch->drem );
+}
+
+/* return the current value with the rounding of a C division, and move to the next pixel */
+static inline INT64 triangle_channel_next( struct triangle_channel *ch )
+{
+    INT64 ret = ch->quot + (ch->quot < 0 && ch->rem);
+
+    ch->quot += ch->dquot;
+    ch->rem += ch->drem;
+    if (ch->rem >= ch->det)
+    {
+        ch->rem -= ch->det;
+        ch->quot++;
+    }
+    return ret;
+}
+
+/* prepare the evaluation of a triangle row starting at x, to avoid divisions for every pixel */
+static inline void triangle_row_init( struct triangle_row *row, const TRIVERTEX *v, int x, int y, int det )
+{
+    triangle_channel_init( &row->r, v, v[0].Red, v[1].Red, v[2].Red, x, y, det );
+    triangle_channel_init( &row->g, v, v[0].Green, v[1].Green, v[2].Green, x, y, det );
+    triangle_channel_init( &row->b, v, v[0].Blue, v[1].Blue, v[2].Blue, x, y, det );
+    triangle_channel_init( &row->a, v, v[0].Alpha, v[1].Alpha, v[2].Alpha, x, y, det );
+}
+
+static inline DWORD gradient_triangle_8888( struct triangle_row *row )
+{
+    BYTE r, g, b, a;
+
+    r = triangle_channel_next( &row->r ) / 256;
+    g = triangle_channel_next( &row->g ) / 256;
+    b = triangle_channel_next( &row->b ) / 256;
+    a = triangle_channel_next( &row->a ) / 256;
     return a << 24 | r << 16 | g << 8 | b;
 }
 
-static inline DWORD gradient_triangle_24( const TRIVERTEX *v, int x, int y, int det )
+static inline DWORD gradient_triangle_24( struct triangle_row *row )
 {
-    INT64 l1, l2;
     BYTE r, g, b;
 
-    triangle_weights( v, x, y, &l1, &l2 );
-    r = (v[0].Red   * l1 + v[1].Red   * l2 + v[2].Red   * (det - l1 - l2)) / det / 256;
-    g = (v[0].Green * l1 + v[1].Green * l2 + v[2].Green * (det - l1 - l2)) / det / 256;
-    b = (v[0].Blue  * l1 + v[1].Blue  * l2 + v[2].Blue  * (det - l1 - l2)) / det / 256;
+    r = triangle_channel_next( &row->r ) / 256;
+    g = triangle_channel_next( &row->g ) / 256;
+    b = triangle_channel_next( &row->b ) / 256;
     return r << 16 | g << 8 | b;
 }
 
@@ -5037,6 +5107,7 @@ static BOOL gradient_rect_8888( const dib_info *dib, const RECT *rc, const TRIVE
 {
     DWORD *ptr = get_pixel_ptr_32( dib, rc->left, rc->top );
     int x, y, left, right, det;
+    struct triangle_row row;
 
     switch (mode)
     {
@@ -5061,7 +5132,8 @@ static BOOL gradient_rect_8888( const dib_info *dib, const RECT *rc, const TRIVE
         for (y = rc->top; y < rc->bottom; y++, ptr += dib->stride / 4)
         {
             triangle_coords( v, rc, y, &left, &right );
-            for (x = left; x < right; x++) ptr[x - rc->left] = gradient_triangle_8888( v, x, y, det );
+            triangle_row_init( &row, v, left, y, det );
+            for (x = left; x < right; x++) ptr[x - rc->left] = gradient_triangle_8888( &row );
         }
         break;
     }
@@ -5072,6 +5144,7 @@ static BOOL gradient_rect_32( const dib_info *dib, const RECT *rc, const TRIVERT
 {
     DWORD *ptr = get_pixel_ptr_32( dib, rc->left, rc->top );
     int x, y, left, right, det;
+    struct triangle_row row;
 
     switch (mode)
     {
@@ -5119,11 +5192,12 @@ static BOOL gradient_rect_32( const dib_info *dib, const RECT *rc, const TRIVERT
         for (y = rc->top; y < rc->bottom; y++, ptr += dib->stride / 4)
         {
             triangle_coords( v, rc, y, &left, &right );
+            triangle_row_init( &row, v, left, y, det );
 
             if (dib->red_len == 8 && dib->green_len == 8 && dib->blue_len == 8)
                 for (x = left; x < right; x++)
                 {
-                    DWORD val = gradient_triangle_24( v, x, y, det );
+                    DWORD val = gradient_triangle_24( &row );
                     ptr[x - rc->left] = ((( val        & 0xff) << dib->blue_shift) |
                                          (((val >> 8)  & 0xff) << dib->green_shift) |
                                          (((val >> 16) & 0xff) << dib->red_shift));
@@ -5131,7 +5205,7 @@ static BOOL gradient_rect_32( const dib_info *dib, const RECT *rc, const TRIVERT
             else
                 for (x = left; x < right; x++)
                 {
-                    DWORD val = gradient_triangle_24( v, x, y, det );
+                    DWORD val = gradient_triangle_24( &row );
                     ptr[x - rc->left] = rgb_to_pixel_masks( dib, val >> 16, val >> 8, val );
                 }
         }
@@ -5144,6 +5218,7 @@ static BOOL gradient_rect_24( const dib_info *dib, const RECT *rc, const TRIVERT
 {
     BYTE *ptr = get_pixel_ptr_24( dib, rc->left, rc->top );
     int x, y, left, right, det;
+    struct triangle_row row;
 
     switch (mode)
     {
@@ -5178,9 +5253,10 @@ static BOOL gradient_rect_24( const dib_info *dib, const RECT *rc, const TRIVERT
         for (y = rc->top; y < rc->bottom; y++, ptr += dib->stride)
         {
             triangle_coords( v, rc, y, &left, &right );
+            triangle_row_init( &row, v, left, y, det );
             for (x = left; x < right; x++)
             {
-                DWORD val = gradient_triangle_24( v, x, y, det );
+                DWORD val = gradient_triangle_24( &row );
                 ptr[(x - rc->left) * 3]     = val;
                 ptr[(x - rc->left) * 3 + 1] = val >> 8;
                 ptr[(x - rc->left) * 3 + 2] = val >> 16;
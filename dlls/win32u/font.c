@@ -1285,15 +1285,24 @@ static void load_face_from_cache( HKEY hkey_family, struct gdi_font_family *fami
 {
     KEY_VALUE_FULL_INFORMATION *info = (KEY_VALUE_FULL_INFORMATION *)buffer;
     KEY_NODE_INFORMATION *node_info = (KEY_NODE_INFORMATION *)buffer;
-    DWORD index = 0, total_size;
+    KEY_FULL_INFORMATION *key_info = (KEY_FULL_INFORMATION *)buffer;
+    DWORD index, total_size, values, subkeys;
     struct gdi_font_face *face;
     HKEY hkey_strike;
     WCHAR name[256];
     struct cached_face *cached;
 
-    while (reg_enum_value( hkey_family, index++, info,
-                           buffer_size - sizeof(DWORD), name, sizeof(name) ))
+    /* get the counts first, this saves a server call per enumeration when
+     * loading the cache, and most families don't have any bitmap strikes */
+    if (NtQueryKey( hkey_family, KeyFullInformation, key_info, buffer_size, &total_size )) return;
+    values = key_info->Values;
+    subkeys = key_info->SubKeys;
+
+    for (index = 0; index < values; index++)
     {
+        if (!reg_enum_value( hkey_family, index, info,
+                             buffer_size - sizeof(DWORD), name, sizeof(name) ))
+            break;
         cached = (struct cached_face *)((char *)info + info->DataOffset);
         if (info->Type == REG_BINARY && info->DataLength > sizeof(*cached))
         {
@@ -1320,10 +1329,11 @@ static void load_face_from_cache( HKEY hkey_family, struct gdi_font_family *fami
 
     /* load bitmap strikes */
 
-    index = 0;
-    while (!NtEnumerateKey( hkey_family, index++, KeyNodeInformation, node_info,
-                            buffer_size, &total_size ))
+    for (index = 0; index < subkeys; index++)
     {
+        if (NtEnumerateKey( hkey_family, index, KeyNodeInformation, node_info,
+                            buffer_size, &total_size ))
+            break;
         if ((hkey_strike = reg_open_key( hkey_family, node_info->Name, node_info->NameLength )))
         {
             load_face_from_cache( hkey_strike, family, buffer, buffer_size, FALSE );
@@ -126,6 +126,26 @@ static inline float from_sRGB_component(float f)
     return powf((f + 0.055f) / 1.055f, 2.4f);
 }
 
+static float sRGB_to_linear[256];
+
+static BOOL WINAPI init_sRGB_to_linear(INIT_ONCE *once, void *param, void **context)
+{
+    UINT i;
+
+    for (i = 0; i < 256; i++)
+        sRGB_to_linear[i] = from_sRGB_component(i / 255.0f);
+    return TRUE;
+}
+
+/* 8-bit components only have 256 possible values, avoid calling powf for each of them */
+static const float *get_sRGB_to_linear_table(void)
+{
+    static INIT_ONCE init_once = INIT_ONCE_STATIC_INIT;
+
+    InitOnceExecuteOnce(&init_once, init_sRGB_to_linear, NULL, NULL);
+    return sRGB_to_linear;
+}
+
 #if 0 /* FIXME: enable once needed */
 
 static void from_sRGB(BYTE *bgr)
@@ -1710,6 +1730,8 @@ static HRESULT copypixels_to_8bppIndexed(struct FormatConverter *This, const WIC
     {
         INT x, y;
         BYTE *src = srcdata, *dst = pbBuffer;
+        UINT color, last_color = ~0u;
+        BYTE index = 0;
 
         for (y = 0; y < prc->Height; y++)
         {
@@ -1717,7 +1739,14 @@ static HRESULT copypixels_to_8bppIndexed(struct FormatConverter *This, const WIC
 
             for (x = 0; x < prc->Width; x++)
             {
-                dst[x] = rgb_to_palette_index(bgr, colors, count);
+                /* images usually have runs of identical pixels, only search the palette when the color changes */
+                color = bgr[0] | (bgr[1] << 8) | (bgr[2] << 16);
+                if (color != last_color)
+                {
+                    index = rgb_to_palette_index(bgr, colors, count);
+                    last_color = color;
+                }
+                dst[x] = index;
                 bgr += 3;
             }
             src += srcstride;
@@ -1862,6 +1891,7 @@ static HRESULT copypixels_to_128bppRGBAFloat(struct FormatConverter *This, const
     case format_24bppBGR:
     {
         UINT srcstride, srcdatasize;
+        const float *to_linear;
         const BYTE *srcpixel;
         const BYTE *srcrow;
         float *dstpixel;
@@ -1878,6 +1908,7 @@ static HRESULT copypixels_to_128bppRGBAFloat(struct FormatConverter *This, const
         srcdata = malloc(srcdatasize);
         if (!srcdata) return E_OUTOFMEMORY;
 
+        to_linear = get_sRGB_to_linear_table();
         hr = IWICBitmapSource_CopyPixels(This->source, prc, srcstride, srcdatasize, srcdata);
         if (SUCCEEDED(hr))
         {
@@ -1889,9 +1920,9 @@ static HRESULT copypixels_to_128bppRGBAFloat(struct FormatConverter *This, const
                 dstpixel= (float *)dstrow;
                 for (x = 0; x < prc->Width; x++)
                 {
-                    dstpixel[2] = from_sRGB_component(*srcpixel++ / 255.0f);
-                    dstpixel[1] = from_sRGB_component(*srcpixel++ / 255.0f);
-                    dstpixel[0] = from_sRGB_component(*srcpixel++ / 255.0f);
+                    dstpixel[2] = to_linear[*srcpixel++];
+                    dstpixel[1] = to_linear[*srcpixel++];
+                    dstpixel[0] = to_linear[*srcpixel++];
                     dstpixel[3] = 1.0f;
 
                     dstpixel += 4;
@@ -1907,6 +1938,7 @@ static HRESULT copypixels_to_128bppRGBAFloat(struct FormatConverter *This, const
     case format_32bppBGRA:
     {
         UINT srcstride, srcdatasize;
+        const float *to_linear;
         const BYTE *srcpixel;
         const BYTE *srcrow;
         float *dstpixel;
@@ -1923,6 +1955,7 @@ static HRESULT copypixels_to_128bppRGBAFloat(struct FormatConverter *This, const
         srcdata = malloc(srcdatasize);
         if (!srcdata) return E_OUTOFMEMORY;
 
+        to_linear = get_sRGB_to_linear_table();
         hr = IWICBitmapSource_CopyPixels(This->source, prc, srcstride, srcdatasize, srcdata);
         if (SUCCEEDED(hr))
         {
@@ -1934,9 +1967,9 @@ static HRESULT copypixels_to_128bppRGBAFloat(struct FormatConverter *This, const
                 dstpixel= (float *)dstrow;
                 for (x = 0; x < prc->Width; x++)
                 {
-                    dstpixel[2] = from_sRGB_component(*srcpixel++ / 255.0f);
-                    dstpixel[1] = from_sRGB_component(*srcpixel++ / 255.0f);
-                    dstpixel[0] = from_sRGB_component(*srcpixel++ / 255.0f);
+                    dstpixel[2] = to_linear[*srcpixel++];
+                    dstpixel[1] = to_linear[*srcpixel++];
+                    dstpixel[0] = to_linear[*srcpixel++];
                     dstpixel[3] = *srcpixel++ / 255.0f;
 
                     dstpixel += 4;
@@ -215,7 +215,8 @@ static HRESULT WINAPI BitmapScaler_CopyPixels(IWICBitmapScaler *iface,
     ULONG bytesperrow;
     ULONG src_bytesperrow;
     ULONG buffer_size;
-    UINT y;
+    UINT y, src_height;
+    BOOL row_by_row;
 
     TRACE("(%p,%s,%u,%u,%p)\n", iface, debug_wic_rect(prc), cbStride, cbBufferSize, pbBuffer);
 
@@ -263,7 +264,8 @@ static HRESULT WINAPI BitmapScaler_CopyPixels(IWICBitmapScaler *iface,
      * once, by saving the data that will be useful for the next scanline after
      * the call returns. The GetRequiredSourceRect/CopyScanline functions are
      * designed to make it possible to do this in a generic way, but for now we
-     * just grab all the data we need in each call. */
+     * grab all the data we need in each call, either as a single block or,
+     * when most source rows are skipped, one source read per scanline. */
 
     This->fn_get_required_source_rect(This, dest_rect.X, dest_rect.Y, &src_rect_ul);
     This->fn_get_required_source_rect(This, dest_rect.X+dest_rect.Width-1,
@@ -275,9 +277,15 @@ static HRESULT WINAPI BitmapScaler_CopyPixels(IWICBitmapScaler *iface,
     src_rect.Height = src_rect_br.Height + src_rect_br.Y - src_rect_ul.Y;
 
     src_bytesperrow = (src_rect.Width * This->bpp + 7)/8;
-    buffer_size = src_bytesperrow * src_rect.Height;
 
-    src_rows = malloc(sizeof(BYTE*) * src_rect.Height);
+    /* When downscaling by at least a factor of two, most source rows are
+     * skipped, so only read the ones needed for each destination scanline.
+     * For milder downscales the per-call overhead outweighs the savings. */
+    row_by_row = dest_rect.Height * src_rect_ul.Height * 2 <= src_rect.Height;
+    src_height = row_by_row ? src_rect_ul.Height : src_rect.Height;
+    buffer_size = src_bytesperrow * src_height;
+
+    src_rows = malloc(sizeof(BYTE*) * src_height);
     src_bits = malloc(buffer_size);
 
     if (!src_rows || !src_bits)
@@ -288,18 +296,44 @@ static HRESULT WINAPI BitmapScaler_CopyPixels(IWICBitmapScaler *iface,
         goto end;
     }
 
-    for (y=0; y<src_rect.Height; y++)
+    for (y=0; y<src_height; y++)
         src_rows[y] = src_bits + y * src_bytesperrow;
 
-    hr = IWICBitmapSource_CopyPixels(This->source, &src_rect, src_bytesperrow,
-        buffer_size, src_bits);
+    if (!row_by_row)
+    {
+        hr = IWICBitmapSource_CopyPixels(This->source, &src_rect, src_bytesperrow,
+            buffer_size, src_bits);
 
-    if (SUCCEEDED(hr))
+        if (SUCCEEDED(hr))
+        {
+            for (y=0; y < dest_rect.Height; y++)
+            {
+                This->fn_copy_scanline(This, dest_rect.X, dest_rect.Y+y, dest_rect.Width,
+                    src_rows, src_rect.X, src_rect.Y, pbBuffer + cbStride * y);
+            }
+        }
+    }
+    else
     {
-        for (y=0; y < dest_rect.Height; y++)
+        WICRect row_rect;
+
+        hr = S_OK;
+        for (y=0; y < dest_rect.Height && SUCCEEDED(hr); y++)
         {
-            This->fn_copy_scanline(This, dest_rect.X, dest_rect.Y+y, dest_rect.Width,
-                src_rows, src_rect.X, src_rect.Y, pbBuffer + cbStride * y);
+            This->fn_get_required_source_rect(This, dest_rect.X, dest_rect.Y+y, &row_rect);
+            row_rect.X = src_rect.X;
+            row_rect.Width = src_rect.Width;
+
+            if (!y || row_rect.Y != src_rect.Y)
+            {
+                src_rect.Y = row_rect.Y;
+                hr = IWICBitmapSource_CopyPixels(This->source, &row_rect, src_bytesperrow,
+                    buffer_size, src_bits);
+            }
+
+            if (SUCCEEDED(hr))
+                This->fn_copy_scanline(This, dest_rect.X, dest_rect.Y+y, dest_rect.Width,
+                    src_rows, src_rect.X, src_rect.Y, pbBuffer + cbStride * y);
         }
     }
 
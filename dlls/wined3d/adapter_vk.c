@@ -362,6 +362,7 @@ static HRESULT adapter_vk_create_device(struct wined3d *wined3d, const struct wi
     struct wined3d_physical_device_info physical_device_info;
     static const float priorities[] = {1.0f};
     VkDeviceQueueCreateInfo queue_info[2];
+    VkPipelineCacheCreateInfo cache_info;
     struct wined3d_device_vk *device_vk;
     VkDevice vk_device = VK_NULL_HANDLE;
     VkPhysicalDevice physical_device;
@@ -442,10 +443,23 @@ static HRESULT adapter_vk_create_device(struct wined3d *wined3d, const struct wi
 #undef VK_DEVICE_EXT_PFN
 #undef VK_DEVICE_PFN
 
+    /* Let the driver reuse compiled shader code between pipelines. */
+    cache_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    cache_info.pNext = NULL;
+    cache_info.flags = 0;
+    cache_info.initialDataSize = 0;
+    cache_info.pInitialData = NULL;
+    if ((vr = VK_CALL(vkCreatePipelineCache(vk_device, &cache_info, NULL, &device_vk->vk_pipeline_cache))) < 0)
+    {
+        WARN("Failed to create Vulkan pipeline cache, vr %s.\n", wined3d_debug_vkresult(vr));
+        device_vk->vk_pipeline_cache = VK_NULL_HANDLE;
+    }
+
     if (!wined3d_allocator_init(&device_vk->allocator,
             adapter_vk->memory_properties.memoryTypeCount, &wined3d_allocator_vk_ops))
     {
         WARN("Failed to initialise allocator.\n");
+        VK_CALL(vkDestroyPipelineCache(vk_device, device_vk->vk_pipeline_cache, NULL));
         hr = E_FAIL;
         goto fail;
     }
@@ -455,6 +469,7 @@ static HRESULT adapter_vk_create_device(struct wined3d *wined3d, const struct wi
     {
         WARN("Failed to initialize device, hr %#lx.\n", hr);
         wined3d_allocator_cleanup(&device_vk->allocator);
+        VK_CALL(vkDestroyPipelineCache(vk_device, device_vk->vk_pipeline_cache, NULL));
         goto fail;
     }
 
@@ -480,6 +495,7 @@ static void adapter_vk_destroy_device(struct wined3d_device *device)
 
     wined3d_lock_cleanup(&device_vk->allocator_cs);
 
+    VK_CALL(vkDestroyPipelineCache(device_vk->vk_device, device_vk->vk_pipeline_cache, NULL));
     VK_CALL(vkDestroyDevice(device_vk->vk_device, NULL));
     free(device_vk);
 }
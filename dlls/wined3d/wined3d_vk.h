@@ -897,6 +897,7 @@ struct wined3d_device_vk
     struct wined3d_context_vk context_vk;
 
     VkDevice vk_device;
+    VkPipelineCache vk_pipeline_cache;
 
     struct wined3d_queue_vk
     {
@@ -1798,7 +1798,9 @@ static BOOL x11drv_surface_flush( struct window_surface *window_surface, const R
     const unsigned char *src = color_bits;
     unsigned char *dst = (unsigned char *)ximage->data;
 
-    if (alpha_bits == -1)
+    /* the padding bits are ignored without an alpha channel, don't spend time setting them */
+    if (ximage->depth != 32) alpha_bits = 0;
+    else if (alpha_bits == -1)
     {
         if (alpha_mask || color_info->bmiHeader.biBitCount != 32) alpha_bits = 0;
         else if (color_info->bmiHeader.biCompression == BI_RGB) alpha_bits = 0xff000000;
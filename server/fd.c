@@ -1093,7 +1093,7 @@ static void unlink_closed_fd( struct inode *inode, struct closed_fd *fd )
     if (!stat( fd->unix_name, &st ) && st.st_dev == inode->device->dev && st.st_ino == inode->ino)
     {
         if (S_ISDIR(st.st_mode)) rmdir( fd->unix_name );
-        else unlink( fd->unix_name );
+        else if (!unlink( fd->unix_name )) remove_image_cache_entry( st.st_dev, st.st_ino );
     }
 }
 
@@ -2063,6 +2063,8 @@ struct fd *open_fd( struct fd *root, const char *name, struct unicode_str nt_nam
             }
             ftruncate( fd->unix_fd, 0 );
         }
+        /* the inode number may belong to a new file, or the contents are about to be rewritten */
+        if (flags & (O_CREAT | O_TRUNC)) remove_image_cache_entry( st.st_dev, st.st_ino );
     }
     else  /* special file */
     {
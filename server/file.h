@@ -193,6 +193,7 @@ extern struct object *create_user_data_mapping( struct object *root, const struc
 extern struct mapping *create_session_mapping( struct object *root, const struct unicode_str *name,
                                                unsigned int attr, const struct security_descriptor *sd );
 extern void set_session_mapping( struct mapping *mapping );
+extern void remove_image_cache_entry( dev_t dev, ino_t ino );
 
 extern session_shm_t *shared_session;
 extern volatile void *alloc_shared_object(void);
@@ -51,7 +51,8 @@ struct handle_table
     struct process      *process;     /* process owning this table */
     int                  count;       /* number of allocated entries */
     int                  last;        /* last used entry */
-    int                  free;        /* first entry that may be free */
+    int                  free_count;  /* number of entries in the free list */
+    int                 *free_list;   /* stack of free entries below last, most recently freed on top */
     struct handle_entry *entries;     /* handle entries */
 };
 
@@ -187,6 +188,7 @@ static void handle_table_destroy( struct object *obj )
         }
     }
     free( table->entries );
+    free( table->free_list );
 }
 
 /* close all the process handles and free the handle table */
@@ -209,8 +211,10 @@ struct handle_table *alloc_handle_table( struct process *process, int count )
     table->process = process;
     table->count   = count;
     table->last    = -1;
-    table->free    = 0;
-    if ((table->entries = mem_alloc( count * sizeof(*table->entries) ))) return table;
+    table->free_count = 0;
+    table->entries    = NULL;
+    if ((table->free_list = mem_alloc( count * sizeof(*table->free_list) )) &&
+        (table->entries = mem_alloc( count * sizeof(*table->entries) ))) return table;
     release_object( table );
     return NULL;
 }
@@ -219,10 +223,17 @@ struct handle_table *alloc_handle_table( struct process *process, int count )
 static int grow_handle_table( struct handle_table *table )
 {
     struct handle_entry *new_entries;
+    int *new_free_list;
     int count = min( table->count * 2, MAX_HANDLE_ENTRIES );
 
     if (count == table->count ||
-        !(new_entries = realloc( table->entries, count * sizeof(struct handle_entry) )))
+        !(new_free_list = realloc( table->free_list, count * sizeof(*new_free_list) )))
+    {
+        set_error( STATUS_INSUFFICIENT_RESOURCES );
+        return 0;
+    }
+    table->free_list = new_free_list;
+    if (!(new_entries = realloc( table->entries, count * sizeof(struct handle_entry) )))
     {
         set_error( STATUS_INSUFFICIENT_RESOURCES );
         return 0;
@@ -232,21 +243,23 @@ static int grow_handle_table( struct handle_table *table )
     return 1;
 }
 
-/* allocate the first free entry in the handle table */
+/* allocate a free entry in the handle table, reusing the most recently freed one */
 static obj_handle_t alloc_entry( struct handle_table *table, void *obj, unsigned int access )
 {
-    struct handle_entry *entry = table->entries + table->free;
+    struct handle_entry *entry;
     int i;
 
-    for (i = table->free; i <= table->last; i++, entry++) if (!entry->ptr) goto found;
-    if (i >= table->count)
+    /* entries above last may have been trimmed by shrink_handle_table since they were freed */
+    while (table->free_count)
     {
-        if (!grow_handle_table( table )) return 0;
-        entry = table->entries + i;  /* the entries may have moved */
+        i = table->free_list[--table->free_count];
+        if (i <= table->last && !table->entries[i].ptr) goto found;
     }
+    i = table->last + 1;
+    if (i >= table->count && !grow_handle_table( table )) return 0;
     table->last = i;
  found:
-    table->free = i + 1;
+    entry = table->entries + i;
     entry->ptr    = grab_object_for_handle( obj );
     entry->access = access;
     return index_to_handle(i);
@@ -342,7 +355,8 @@ static void shrink_handle_table( struct handle_table *table )
 {
     struct handle_entry *entry = table->entries + table->last;
     struct handle_entry *new_entries;
-    int count = table->count;
+    int *new_free_list;
+    int i, j, count = table->count;
 
     while (table->last >= 0)
     {
@@ -356,6 +370,13 @@ static void shrink_handle_table( struct handle_table *table )
     if (!(new_entries = realloc( table->entries, count * sizeof(*new_entries) ))) return;
     table->count   = count;
     table->entries = new_entries;
+
+    /* drop the trimmed entries so that the free list still fits in the table size */
+    for (i = j = 0; i < table->free_count; i++)
+        if (table->free_list[i] <= table->last) table->free_list[j++] = table->free_list[i];
+    table->free_count = j;
+    if ((new_free_list = realloc( table->free_list, count * sizeof(*new_free_list) )))
+        table->free_list = new_free_list;
 }
 
 static void inherit_handle( struct process *parent, const obj_handle_t handle, struct handle_table *table )
@@ -420,6 +441,10 @@ struct handle_table *copy_handle_table( struct process *process, struct process
     }
     /* attempt to shrink the table */
     shrink_handle_table( table );
+
+    /* push the holes so that the lowest ones get reused first */
+    for (i = table->last; i >= 0; i--)
+        if (!table->entries[i].ptr) table->free_list[table->free_count++] = i;
     return table;
 }
 
@@ -436,8 +461,8 @@ unsigned int close_handle( struct process *process, obj_handle_t handle )
     if (!obj->ops->close_handle( obj, process, handle )) return STATUS_HANDLE_NOT_CLOSABLE;
     entry->ptr = NULL;
     table = handle_is_global(handle) ? global_table : process->handles;
-    if (entry < table->entries + table->free) table->free = entry - table->entries;
     if (entry == table->entries + table->last) shrink_handle_table( table );
+    else table->free_list[table->free_count++] = entry - table->entries;
     release_object_from_handle( obj );
     return STATUS_SUCCESS;
 }
@@ -123,6 +123,25 @@ static const struct object_ops shared_map_ops =
 
 static struct list shared_map_list = LIST_INIT( shared_map_list );
 
+/* cached image parameters of a PE file, to avoid parsing the same headers for every process */
+struct image_cache_entry
+{
+    struct list          entry;      /* entry in image cache list */
+    dev_t                dev;        /* file identity */
+    ino_t                ino;
+    file_pos_t           size;       /* file size and times used to detect modifications */
+    time_t               mtime;
+    time_t               ctime;
+    long                 mtime_nsec;
+    long                 ctime_nsec;
+    struct pe_image_info image;      /* image info, map_addr is not cached */
+};
+
+#define MAX_IMAGE_CACHE_ENTRIES 512
+
+static struct list image_cache = LIST_INIT( image_cache );
+static unsigned int image_cache_count;
+
 /* memory view mapped in client address space */
 struct memory_view
 {
@@ -744,8 +763,98 @@ static int load_cfg_header( IMAGE_LOAD_CONFIG_DIRECTORY64 *cfg, size_t va, size_
     return 1;
 }
 
+/* retrieve the sub-second part of the modification and change times */
+static void get_stat_time_nsec( const struct stat *st, long *mtime_nsec, long *ctime_nsec )
+{
+    *mtime_nsec = *ctime_nsec = 0;
+#ifdef HAVE_STRUCT_STAT_ST_MTIM
+    *mtime_nsec = st->st_mtim.tv_nsec;
+#elif defined(HAVE_STRUCT_STAT_ST_MTIMESPEC)
+    *mtime_nsec = st->st_mtimespec.tv_nsec;
+#endif
+#ifdef HAVE_STRUCT_STAT_ST_CTIM
+    *ctime_nsec = st->st_ctim.tv_nsec;
+#elif defined(HAVE_STRUCT_STAT_ST_CTIMESPEC)
+    *ctime_nsec = st->st_ctimespec.tv_nsec;
+#endif
+}
+
+static void free_image_cache_entry( struct image_cache_entry *cache )
+{
+    list_remove( &cache->entry );
+    image_cache_count--;
+    free( cache );
+}
+
+/* find the cached image parameters for a file, if they are still valid */
+static struct image_cache_entry *find_image_cache_entry( const struct stat *st )
+{
+    struct image_cache_entry *cache;
+    long mtime_nsec, ctime_nsec;
+
+    get_stat_time_nsec( st, &mtime_nsec, &ctime_nsec );
+
+    LIST_FOR_EACH_ENTRY( cache, &image_cache, struct image_cache_entry, entry )
+    {
+        if (cache->dev != st->st_dev || cache->ino != st->st_ino) continue;
+        if (cache->size == st->st_size && cache->mtime == st->st_mtime && cache->ctime == st->st_ctime &&
+            cache->mtime_nsec == mtime_nsec && cache->ctime_nsec == ctime_nsec)
+        {
+            /* move it to the head of the list */
+            list_remove( &cache->entry );
+            list_add_head( &image_cache, &cache->entry );
+            return cache;
+        }
+        /* the file has been modified, the entry is stale */
+        free_image_cache_entry( cache );
+        return NULL;
+    }
+    return NULL;
+}
+
+/* drop the cached image parameters of a file that is being created, truncated or deleted,
+ * since its contents may change, or its inode number be reused, within the time resolution */
+void remove_image_cache_entry( dev_t dev, ino_t ino )
+{
+    struct image_cache_entry *cache;
+
+    LIST_FOR_EACH_ENTRY( cache, &image_cache, struct image_cache_entry, entry )
+    {
+        if (cache->dev != dev || cache->ino != ino) continue;
+        free_image_cache_entry( cache );
+        return;
+    }
+}
+
+/* add the parameters of a successfully loaded image to the cache */
+static void add_image_cache_entry( const struct stat *st, const struct pe_image_info *image )
+{
+    struct image_cache_entry *cache;
+
+    if (image_cache_count >= MAX_IMAGE_CACHE_ENTRIES)
+    {
+        /* reuse the least recently used entry */
+        cache = LIST_ENTRY( list_tail( &image_cache ), struct image_cache_entry, entry );
+        list_remove( &cache->entry );
+    }
+    else
+    {
+        if (!(cache = malloc( sizeof(*cache) ))) return;
+        image_cache_count++;
+    }
+    cache->dev   = st->st_dev;
+    cache->ino   = st->st_ino;
+    cache->size  = st->st_size;
+    cache->mtime = st->st_mtime;
+    cache->ctime = st->st_ctime;
+    get_stat_time_nsec( st, &cache->mtime_nsec, &cache->ctime_nsec );
+    cache->image = *image;
+    cache->image.map_addr = 0;
+    list_add_head( &image_cache, &cache->entry );
+}
+
 /* retrieve the mapping parameters for an executable (PE) image */
-static unsigned int get_image_params( struct mapping *mapping, file_pos_t file_size, int unix_fd )
+static unsigned int get_image_params( struct mapping *mapping, const struct stat *st, int unix_fd )
 {
     static const char builtin_signature[] = "Wine builtin DLL";
     static const char fakedll_signature[] = "Wine placeholder DLL";
@@ -772,14 +881,26 @@ static unsigned int get_image_params( struct mapping *mapping, file_pos_t file_s
         IMAGE_LOAD_CONFIG_DIRECTORY32 cfg32;
         IMAGE_LOAD_CONFIG_DIRECTORY64 cfg64;
     } cfg;
+    struct image_cache_entry *cache;
+    file_pos_t file_size = st->st_size;
     off_t pos;
     int size, has_relocs;
     size_t mz_size, clr_va = 0, clr_size = 0, cfg_va, cfg_size, align_mask;
     unsigned int i, ret;
 
+    if (!file_size) return STATUS_INVALID_FILE_FOR_SECTION;
+
+    if ((cache = find_image_cache_entry( st )))
+    {
+        if (!mapping->size) mapping->size = cache->image.map_size;
+        else if (mapping->size > cache->image.map_size) return STATUS_SECTION_TOO_BIG;
+        mapping->image = cache->image;
+        mapping->image.map_addr = get_fd_map_address( mapping->fd );
+        return STATUS_SUCCESS;
+    }
+
     /* load the headers */
 
-    if (!file_size) return STATUS_INVALID_FILE_FOR_SECTION;
     size = pread( unix_fd, &mz, sizeof(mz), 0 );
     if (size < sizeof(mz.dos)) return STATUS_INVALID_IMAGE_NOT_MZ;
     if (mz.dos.e_magic != IMAGE_DOS_SIGNATURE) return STATUS_INVALID_IMAGE_NOT_MZ;
@@ -963,7 +1084,11 @@ static unsigned int get_image_params( struct mapping *mapping, file_pos_t file_s
     }
 
     if (build_shared_mapping( mapping, align_mask, unix_fd, sec, nt.FileHeader.NumberOfSections ))
+    {
+        /* images with shared sections need to be set up for every mapping */
+        if (!mapping->shared) add_image_cache_entry( st, &mapping->image );
         ret = STATUS_SUCCESS;
+    }
 
 done:
     free( sec );
@@ -1059,7 +1184,7 @@ static struct mapping *create_mapping( struct object *root, const struct unicode
         }
         if (flags & SEC_IMAGE)
         {
-            unsigned int err = get_image_params( mapping, st.st_size, unix_fd );
+            unsigned int err = get_image_params( mapping, &st, unix_fd );
             if (!err) return mapping;
             set_error( err );
             goto error;
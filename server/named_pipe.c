@@ -606,7 +606,7 @@ static void named_pipe_device_destroy( struct object *obj )
 {
     struct named_pipe_device *device = (struct named_pipe_device*)obj;
     assert( obj->ops == &named_pipe_device_ops );
-    free( device->pipes );
+    free_namespace( device->pipes );
 }
 
 struct object *create_named_pipe_device( struct object *root, const struct unicode_str *name,
@@ -48,9 +48,15 @@
 struct namespace
 {
     unsigned int        hash_size;       /* size of hash table */
-    struct list         names[1];        /* array of hash entry lists */
+    unsigned int        count;           /* names added since the last recount */
+    struct list        *names;           /* array of hash entry lists */
+    struct list         index;           /* all names in the order they were added */
 };
 
+/* prime sizes to grow namespace hash tables to, the last one is the maximum */
+static const unsigned int namespace_hash_sizes[] = { 31, 127, 509, 2039, 8191, 32749, 65521 };
+#define MAX_NAMESPACE_HASH_SIZE 65521
+
 
 struct type_descr no_type =
 {
@@ -238,11 +244,48 @@ void *memdup( const void *data, size_t len )
 
 /*****************************************************************/
 
-void namespace_add( struct namespace *namespace, struct object_name *ptr )
+/* grow the hash table once the chains get too long; names are unlinked without
+ * the namespace knowing about it, so the count is only an upper bound until recounted.
+ * Enumeration goes through the index list, so the new bucket order doesn't change it. */
+static void grow_namespace( struct namespace *namespace )
 {
-    unsigned int hash = hash_strW( ptr->name, ptr->len, namespace->hash_size );
+    struct list *names, *ptr, *next;
+    unsigned int i, count = 0, hash_size = MAX_NAMESPACE_HASH_SIZE;
+
+    for (i = 0; i < namespace->hash_size; i++) count += list_count( &namespace->names[i] );
+    namespace->count = count;
+    if (count <= 2 * namespace->hash_size) return;
+
+    for (i = 0; i < ARRAY_SIZE(namespace_hash_sizes); i++)
+    {
+        if (namespace_hash_sizes[i] < namespace->hash_size * 4) continue;
+        hash_size = namespace_hash_sizes[i];
+        break;
+    }
+    if (hash_size <= namespace->hash_size) return;
+    if (!(names = malloc( hash_size * sizeof(*names) ))) return;
+    for (i = 0; i < hash_size; i++) list_init( &names[i] );
+    for (i = 0; i < namespace->hash_size; i++)
+    {
+        LIST_FOR_EACH_SAFE( ptr, next, &namespace->names[i] )
+        {
+            struct object_name *name = LIST_ENTRY( ptr, struct object_name, entry );
+            list_remove( &name->entry );
+            list_add_tail( &names[name->hash % hash_size], &name->entry );
+        }
+    }
+    free( namespace->names );
+    namespace->names = names;
+    namespace->hash_size = hash_size;
+}
 
-    list_add_head( &namespace->names[hash], &ptr->entry );
+void namespace_add( struct namespace *namespace, struct object_name *ptr )
+{
+    ptr->hash = get_hash_strW( ptr->name, ptr->len );
+    if (++namespace->count > 4 * namespace->hash_size && namespace->hash_size < MAX_NAMESPACE_HASH_SIZE)
+        grow_namespace( namespace );
+    list_add_head( &namespace->names[ptr->hash % namespace->hash_size], &ptr->entry );
+    list_add_tail( &namespace->index, &ptr->index_entry );
 }
 
 /* allocate a name for an object */
@@ -564,14 +607,16 @@ struct object *find_object( const struct namespace *namespace, const struct unic
 {
     const struct list *list;
     struct list *p;
+    unsigned int hash;
 
     if (!name || !name->len) return NULL;
 
-    list = &namespace->names[ hash_strW( name->str, name->len, namespace->hash_size ) ];
+    hash = get_hash_strW( name->str, name->len );
+    list = &namespace->names[hash % namespace->hash_size];
     LIST_FOR_EACH( p, list )
     {
         const struct object_name *ptr = LIST_ENTRY( p, struct object_name, entry );
-        if (ptr->len != name->len) continue;
+        if (ptr->hash != hash || ptr->len != name->len) continue;
         if (attributes & OBJ_CASE_INSENSITIVE)
         {
             if (!memicmp_strW( ptr->name, name->str, name->len ))
@@ -587,18 +632,15 @@ struct object *find_object( const struct namespace *namespace, const struct unic
 }
 
 /* find an object by its index; the refcount is incremented */
+/* names are indexed in the order they were added, so new ones don't shift existing indices */
 struct object *find_object_index( const struct namespace *namespace, unsigned int index )
 {
-    unsigned int i;
+    const struct object_name *ptr;
 
     /* FIXME: not efficient at all */
-    for (i = 0; i < namespace->hash_size; i++)
+    LIST_FOR_EACH_ENTRY( ptr, &namespace->index, const struct object_name, index_entry )
     {
-        const struct object_name *ptr;
-        LIST_FOR_EACH_ENTRY( ptr, &namespace->names[i], const struct object_name, entry )
-        {
-            if (!index--) return grab_object( ptr->obj );
-        }
+        if (!index--) return grab_object( ptr->obj );
     }
     return NULL;
 }
@@ -609,15 +651,27 @@ struct namespace *create_namespace( unsigned int hash_size )
     struct namespace *namespace;
     unsigned int i;
 
-    namespace = mem_alloc( sizeof(*namespace) + (hash_size - 1) * sizeof(namespace->names[0]) );
-    if (namespace)
+    if (!(namespace = mem_alloc( sizeof(*namespace) ))) return NULL;
+    if (!(namespace->names = mem_alloc( hash_size * sizeof(namespace->names[0]) )))
     {
-        namespace->hash_size      = hash_size;
-        for (i = 0; i < hash_size; i++) list_init( &namespace->names[i] );
+        free( namespace );
+        return NULL;
     }
+    namespace->hash_size      = hash_size;
+    namespace->count          = 0;
+    list_init( &namespace->index );
+    for (i = 0; i < hash_size; i++) list_init( &namespace->names[i] );
     return namespace;
 }
 
+/* free a namespace; all the names must have been unlinked already */
+void free_namespace( struct namespace *namespace )
+{
+    if (!namespace) return;
+    free( namespace->names );
+    free( namespace );
+}
+
 /* functions for unimplemented/default object operations */
 
 int no_add_queue( struct object *obj, struct wait_queue_entry *entry )
@@ -806,6 +860,7 @@ int no_link_name( struct object *obj, struct object_name *name, struct object *p
 void default_unlink_name( struct object *obj, struct object_name *name )
 {
     list_remove( &name->entry );
+    list_remove( &name->index_entry );
 }
 
 struct object *no_open_file( struct object *obj, unsigned int access, unsigned int sharing,
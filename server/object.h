@@ -128,9 +128,11 @@ struct object
 struct object_name
 {
     struct list         entry;           /* entry in the hash list */
+    struct list         index_entry;     /* entry in the namespace list of all names */
     struct object      *obj;             /* object owning this name */
     struct object      *parent;          /* parent object */
     data_size_t         len;             /* name length in bytes */
+    unsigned int        hash;            /* case-insensitive hash of the name */
     WCHAR               name[1];
 };
 
@@ -160,6 +162,7 @@ extern void *open_named_object( struct object *parent, const struct object_ops *
                                 const struct unicode_str *name, unsigned int attributes );
 extern void unlink_named_object( struct object *obj );
 extern struct namespace *create_namespace( unsigned int hash_size );
+extern void free_namespace( struct namespace *namespace );
 extern void free_kernel_objects( struct object *obj );
 /* grab/release_object can take any pointer, but you better make sure */
 /* that the thing pointed to starts with a struct object... */
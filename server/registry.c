@@ -235,6 +235,10 @@ static void dump_path( const struct key *key, const struct key *base, FILE *f )
 /* dump a value to a text file */
 static void dump_value( const struct key_value *value, FILE *f )
 {
+    static const char hex[16] = "0123456789abcdef";
+    const unsigned char *data = value->data;
+    char buffer[256];
+    char *pos = buffer;
     unsigned int i, dw;
     int count;
 
@@ -272,18 +276,27 @@ static void dump_value( const struct key_value *value, FILE *f )
     else count += fprintf( f, "hex(%x):", value->type );
     for (i = 0; i < value->len; i++)
     {
-        count += fprintf( f, "%02x", *((unsigned char *)value->data + i) );
+        if (pos > buffer + sizeof(buffer) - 8)
+        {
+            fwrite( buffer, pos - buffer, 1, f );
+            pos = buffer;
+        }
+        *pos++ = hex[data[i] >> 4];
+        *pos++ = hex[data[i] & 0x0f];
+        count += 2;
         if (i < value->len-1)
         {
-            fputc( ',', f );
+            *pos++ = ',';
             if (++count > 76)
             {
-                fprintf( f, "\\\n  " );
+                memcpy( pos, "\\\n  ", 4 );
+                pos += 4;
                 count = 2;
             }
         }
     }
-    fputc( '\n', f );
+    *pos++ = '\n';
+    fwrite( buffer, pos - buffer, 1, f );
 }
 
 /* find the named child of a given key and return its index */
@@ -1561,20 +1574,35 @@ static int load_key_option( struct key *key, const char *buffer, struct file_loa
     return 1;
 }
 
+/* convert a hex digit to its value, or return -1 if it isn't one */
+static inline int hex_digit_value( char ch )
+{
+    if (ch >= '0' && ch <= '9') return ch - '0';
+    if (ch >= 'a' && ch <= 'f') return ch - 'a' + 10;
+    if (ch >= 'A' && ch <= 'F') return ch - 'A' + 10;
+    return -1;
+}
+
 /* parse a comma-separated list of hex digits */
 static int parse_hex( unsigned char *dest, data_size_t *len, const char *buffer )
 {
     const char *p = buffer;
     data_size_t count = 0;
-    char *end;
+    int digit;
 
-    while (isxdigit(*p))
+    while ((digit = hex_digit_value( *p )) != -1)
     {
-        unsigned int val = strtoul( p, &end, 16 );
-        if (end == p || val > 0xff) return -1;
+        unsigned int val = 0;
+
+        /* most of the time there are exactly two digits, but allow for leading zeros */
+        do
+        {
+            val = val * 16 + digit;
+            if (val > 0xff) return -1;
+        } while ((digit = hex_digit_value( *++p )) != -1);
+
         if (count++ >= *len) return -1;  /* dest buffer overflow */
         *dest++ = val;
-        p = end;
         while (isspace(*p)) p++;
         if (*p == ',') p++;
         while (isspace(*p)) p++;
@@ -1813,6 +1841,7 @@ static int load_init_registry_from_file( const char *filename, struct key *key )
 
     if ((f = fopen( filename, "r" )))
     {
+        setvbuf( f, NULL, _IOFBF, 256 * 1024 );
         load_keys( key, filename, f, 0 );
         fclose( f );
         if (get_error() == STATUS_NOT_REGISTRY_FILE)
@@ -2101,6 +2130,9 @@ static int save_branch( struct key *key, const char *filename )
         goto done;
     }
 
+    /* use a large buffer, registry files are usually big */
+    setvbuf( f, NULL, _IOFBF, 256 * 1024 );
+
     if (debug_level > 1)
     {
         fprintf( stderr, "%s: ", filename );
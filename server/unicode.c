@@ -68,6 +68,7 @@ static inline char to_hex( char ch )
 
 static inline WCHAR to_lower( WCHAR ch )
 {
+    if (ch < 0x80) return (ch >= 'A' && ch <= 'Z') ? ch + 'a' - 'A' : ch;
     return ch + casemap[casemap[casemap[ch >> 8] + ((ch >> 4) & 0x0f)] + (ch & 0x0f)];
 }
 
@@ -76,16 +77,21 @@ int memicmp_strW( const WCHAR *str1, const WCHAR *str2, data_size_t len )
     int ret = 0;
 
     for (len /= sizeof(WCHAR); len; str1++, str2++, len--)
-        if ((ret = to_lower(*str1) - to_lower(*str2))) break;
+        if (*str1 != *str2 && (ret = to_lower(*str1) - to_lower(*str2))) break;
     return ret;
 }
 
-unsigned int hash_strW( const WCHAR *str, data_size_t len, unsigned int hash_size )
+unsigned int get_hash_strW( const WCHAR *str, data_size_t len )
 {
     unsigned int i, hash = 0;
 
     for (i = 0; i < len / sizeof(WCHAR); i++) hash = hash * 65599 + to_lower( str[i] );
-    return hash % hash_size;
+    return hash;
+}
+
+unsigned int hash_strW( const WCHAR *str, data_size_t len, unsigned int hash_size )
+{
+    return get_hash_strW( str, len ) % hash_size;
 }
 
 WCHAR *ascii_to_unicode_str( const char *str, struct unicode_str *ret )